@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef EZMQ_BENCHMARK_HELPER_H_
+#define EZMQ_BENCHMARK_HELPER_H_
+
+#include <string>
+
+#include "EZMQAPI.h"
+#include "Event.pb.h"
+
+// Ports used by benchmarks, apart from ports of unit tests
+#define BENCHMARK_PUB_PORT 5590
+#define BENCHMARK_SUB_PORT 5591
+
+inline void initializeApi()
+{
+    static bool initialized = (ezmq::EZMQAPI::getInstance()->initialize(), true);
+    (void)initialized;
+}
+
+inline ezmq::Event makeEvent(int readingCount)
+{
+    ezmq::Event event;
+    event.set_device("device");
+    event.set_created(10);
+    event.set_modified(20);
+    event.set_id("id");
+    event.set_pushed(10);
+    event.set_origin(20);
+    for (int i = 0; i < readingCount; i++)
+    {
+        ezmq::Reading *reading = event.add_reading();
+        reading->set_name("reading" + std::to_string(i));
+        reading->set_value(std::to_string(i * 10));
+        reading->set_created(25);
+        reading->set_device("device");
+        reading->set_modified(20);
+        reading->set_id("id" + std::to_string(i));
+        reading->set_origin(25);
+        reading->set_pushed(1);
+    }
+    return event;
+}
+
+#endif //EZMQ_BENCHMARK_HELPER_H_
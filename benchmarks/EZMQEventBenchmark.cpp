@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelper.h"
+
+// Arg: number of readings in event
+static void BM_EventSerialize(benchmark::State &state)
+{
+    ezmq::Event event = makeEvent(state.range(0));
+    std::string data;
+    for (auto _ : state)
+    {
+        event.SerializeToString(&data);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_EventSerialize)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_EventParse(benchmark::State &state)
+{
+    std::string data;
+    makeEvent(state.range(0)).SerializeToString(&data);
+    for (auto _ : state)
+    {
+        ezmq::Event event;
+        benchmark::DoNotOptimize(event.ParseFromString(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_EventParse)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
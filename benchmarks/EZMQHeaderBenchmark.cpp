@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EZMQHeader.h"
+#include "EZMQMessage.h"
+
+using namespace ezmq;
+
+static EZMQHeader makeHeader(bool extensions)
+{
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_PROTOBUF);
+    if (extensions)
+    {
+        header.setSequence(1, 100);
+        header.setTimestamp(1000000);
+        header.setSchemaId(7);
+    }
+    return header;
+}
+
+// Arg: 0 for version 1 header, 1 for version 2 header with extensions
+static void BM_HeaderEncode(benchmark::State &state)
+{
+    EZMQHeader header = makeHeader(0 != state.range(0));
+    std::vector<unsigned char> frame(header.getSize());
+    for (auto _ : state)
+    {
+        header.write(&frame[0]);
+        benchmark::DoNotOptimize(frame.data());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_HeaderEncode)->Arg(0)->Arg(1);
+
+static void BM_HeaderDecode(benchmark::State &state)
+{
+    EZMQHeader header = makeHeader(0 != state.range(0));
+    std::vector<unsigned char> frame(header.getSize());
+    header.write(&frame[0]);
+    for (auto _ : state)
+    {
+        EZMQHeader decoded;
+        benchmark::DoNotOptimize(decoded.parse(&frame[0], frame.size()));
+        benchmark::DoNotOptimize(decoded.getContentType());
+    }
+}
+BENCHMARK(BM_HeaderDecode)->Arg(0)->Arg(1);
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelper.h"
+#include "EZMQPublisher.h"
+#include "EZMQByteData.h"
+
+using namespace ezmq;
+
+// Unwatched topics are skipped after sanitization, so this is the cost of
+// validating and normalizing the topic of a publish call.
+// Arg: number of levels in topic
+static void BM_TopicSanitization(benchmark::State &state)
+{
+    initializeApi();
+    EZMQPUBCallback callback;
+    EZMQPublisher publisher(BENCHMARK_PUB_PORT, &callback);
+    publisher.setSkipUnwatchedTopics(true);
+    if (EZMQ_OK != publisher.start())
+    {
+        state.SkipWithError("Publisher start failed");
+        return;
+    }
+
+    std::string topic = "home";
+    for (int i = 1; i < state.range(0); i++)
+    {
+        topic += "/level" + std::to_string(i);
+    }
+    ezmq::Event event = makeEvent(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(publisher.publish(topic, event));
+    }
+    publisher.stop();
+}
+BENCHMARK(BM_TopicSanitization)->Arg(1)->Arg(4)->Arg(16);
+
+// No subscriber is connected, so this is the cost of the library and the
+// socket up to the point ZMQ drops the message.
+// Arg: payload size in bytes
+static void BM_ByteDataPublish(benchmark::State &state)
+{
+    initializeApi();
+    EZMQPUBCallback callback;
+    EZMQPublisher publisher(BENCHMARK_PUB_PORT, &callback);
+    if (EZMQ_OK != publisher.start())
+    {
+        state.SkipWithError("Publisher start failed");
+        return;
+    }
+
+    std::vector<uint8_t> payload(state.range(0), 0x5A);
+    EZMQByteData byteData(payload.data(), payload.size());
+    std::string topic = "topic";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(publisher.publish(topic, byteData));
+    }
+    state.SetBytesProcessed(state.iterations() * payload.size());
+    publisher.stop();
+}
+BENCHMARK(BM_ByteDataPublish)->RangeMultiplier(4)->Range(64, 16 << 20);
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelper.h"
+#include "EZMQHeader.h"
+#include "EZMQPublisher.h"
+#include "EZMQSubscriber.h"
+
+using namespace ezmq;
+
+// Messages published before waiting for subscriber, below ZMQ high water mark
+#define RECEIVE_BATCH 100
+
+// Decoding steps of subscriber for a protobuf event: header and event frames.
+// Arg: number of readings in event
+static void BM_SubscriberDecode(benchmark::State &state)
+{
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_PROTOBUF);
+    header.setSequence(1, 100);
+    header.setTimestamp(1000000);
+    std::vector<unsigned char> headerFrame(header.getSize());
+    header.write(&headerFrame[0]);
+    std::string dataFrame;
+    makeEvent(state.range(0)).SerializeToString(&dataFrame);
+
+    for (auto _ : state)
+    {
+        EZMQHeader decoded;
+        benchmark::DoNotOptimize(decoded.parse(&headerFrame[0], headerFrame.size()));
+        ezmq::Event event;
+        benchmark::DoNotOptimize(event.ParseFromString(dataFrame));
+    }
+    state.SetBytesProcessed(state.iterations() * (headerFrame.size() + dataFrame.size()));
+}
+BENCHMARK(BM_SubscriberDecode)->Arg(1)->Arg(10)->Arg(100);
+
+// Receive path of subscriber over TCP loopback, from socket to application callback.
+// Arg: number of readings in event
+static void BM_SubscriberReceive(benchmark::State &state)
+{
+    initializeApi();
+    std::atomic<uint64_t> received(0);
+    EZMQPUBCallback pubCallback;
+    EZMQPublisher publisher(BENCHMARK_SUB_PORT, &pubCallback);
+    EZMQSubscriber subscriber("localhost", BENCHMARK_SUB_PORT,
+        [](const EZMQMessage &) {},
+        [&received](const std::string &, const EZMQMessage &) { received++; });
+    std::string topic = "topic";
+    if (EZMQ_OK != publisher.start() || EZMQ_OK != subscriber.start() ||
+        EZMQ_OK != subscriber.subscribe(topic))
+    {
+        state.SkipWithError("Start failed");
+        return;
+    }
+
+    // Wait for subscription to reach publisher
+    ezmq::Event event = makeEvent(state.range(0));
+    for (int i = 0; i < 100 && 0 == received; i++)
+    {
+        publisher.publish(topic, event);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (0 == received)
+    {
+        state.SkipWithError("Subscriber is not connected");
+        return;
+    }
+
+    uint64_t sent = received;
+    for (auto _ : state)
+    {
+        publisher.publish(topic, event);
+        if (0 == ++sent % RECEIVE_BATCH)
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (received < sent && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+            if (received < sent)
+            {
+                state.SkipWithError("Messages are lost");
+                break;
+            }
+        }
+    }
+    subscriber.stop();
+    publisher.stop();
+}
+BENCHMARK(BM_SubscriberReceive)->Arg(1)->Arg(10)->Arg(100)->UseRealTime();
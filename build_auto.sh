@@ -29,10 +29,14 @@ EZMQ_TARGET_ARCH="$(uname -m)"
 EZMQ_WITH_DEP=false
 EZMQ_BUILD_MODE="release"
 EZMQ_WITH_SECURITY=true
+EZMQ_WITH_PGO=false
+EZMQ_WITH_COMPRESSION=false
 
 RELEASE="1"
 LOGGING=false
 SECURED="1"
+BUILD_PROFILE="default"
+COMPRESSION="0"
 ZMQ_LIBSODIUM="yes"
 
 install_dependencies() {
@@ -153,28 +157,44 @@ install_dependencies() {
     echo -e "${GREEN}Install dependencies done${NO_COLOUR}"
 }
 
-build_native() {
+build_native_pgo() {
+    # Instrumented build, training run of benchmark suite, then optimized build
+    PGO_ARCH=${EZMQ_TARGET_ARCH}
     if [ "armhf-native" = ${EZMQ_TARGET_ARCH} ]; then
-        scons TARGET_OS=linux TARGET_ARCH=armhf RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}           
+        PGO_ARCH="armhf"
+    fi
+    PGO_BUILD_DIR="${PROJECT_ROOT}/out/linux/${PGO_ARCH}/release"
+    rm -rf "${PGO_BUILD_DIR}/pgo"
+    scons TARGET_OS=linux TARGET_ARCH=${PGO_ARCH} RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION} PGO=generate BENCHMARK=1 || exit 1
+    echo -e "${BLUE}Running benchmarks for profile data${NO_COLOUR}"
+    LD_LIBRARY_PATH="${PGO_BUILD_DIR}" "${PGO_BUILD_DIR}/benchmarks/ezmq_benchmarks" || exit 1
+    scons TARGET_OS=linux TARGET_ARCH=${PGO_ARCH} RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION} PGO=use
+}
+
+build_native() {
+    if [ ${EZMQ_WITH_PGO} = true ]; then
+        build_native_pgo
+    elif [ "armhf-native" = ${EZMQ_TARGET_ARCH} ]; then
+        scons TARGET_OS=linux TARGET_ARCH=armhf RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}           
     else
-        scons TARGET_OS=linux TARGET_ARCH=${EZMQ_TARGET_ARCH} RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}    
+        scons TARGET_OS=linux TARGET_ARCH=${EZMQ_TARGET_ARCH} RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}    
     fi
 }
 
 build_arm() {
-    scons TARGET_ARCH=arm TC_PREFIX=/usr/bin/arm-linux-gnueabi- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}    
+    scons TARGET_ARCH=arm TC_PREFIX=/usr/bin/arm-linux-gnueabi- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}    
 }
 
 build_arm64() {
-    scons TARGET_ARCH=arm64 TC_PREFIX=/usr/bin/aarch64-linux-gnu- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}    
+    scons TARGET_ARCH=arm64 TC_PREFIX=/usr/bin/aarch64-linux-gnu- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}    
 }
 
 build_armhf() {
-   scons TARGET_ARCH=armhf TC_PREFIX=/usr/bin/arm-linux-gnueabihf- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}    
+   scons TARGET_ARCH=armhf TC_PREFIX=/usr/bin/arm-linux-gnueabihf- TC_PATH=/usr/bin/ RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}    
 }
 
 build_armhf_qemu() {
-    scons TARGET_ARCH=armhf RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED}    
+    scons TARGET_ARCH=armhf RELEASE=${RELEASE} LOGGING=${LOGGING} SECURED=${SECURED} BUILD_PROFILE=${BUILD_PROFILE} COMPRESSION=${COMPRESSION}    
 
     if [ -x "/usr/bin/qemu-arm-static" ]; then
         echo -e "${BLUE}qemu-arm-static found, copying it to current directory${NO_COLOUR}"
@@ -202,7 +222,9 @@ usage() {
     echo -e "${GREEN}Options:${NO_COLOUR}"
     echo "  --target_arch=[x86|x86_64|arm|arm64|armhf|armhf-qemu|armhf-native] :  Choose Target Architecture"
     echo "  --with_dependencies=[true|false](default: false)                   :  Build ezmq along with dependencies [zmq and protobuf]"
-    echo "  --build_mode=[release|debug](default: release)                     :  Build ezmq library and samples in release or debug mode"
+    echo "  --build_mode=[release|debug|perf](default: release)                :  Build ezmq library and samples in release, debug or perf [C++17, -O3, LTO] mode"
+    echo "  --with_compression=[true|false](default: false)                    :  Build ezmq library with payload compression [liblz4, libzstd]"
+    echo "  --with_pgo=[true|false](default: false)                            :  Profile guided optimization of perf mode, trained by benchmarks [native build only]"
     echo "  --with_security=[true|false](default: true)                        :  Build ezmq library with or without Security feature"
     echo "  -c                                                                 :  Clean ezmq Repository and its dependencies"
     echo "  -h / --help                                                        :  Display help and exit"
@@ -218,6 +240,8 @@ build() {
     echo -e "${GREEN}Build mode is: $EZMQ_BUILD_MODE${NO_COLOUR}"
     echo -e "${GREEN}Build with depedencies: ${EZMQ_WITH_DEP}${NO_COLOUR}"
     echo -e "${GREEN}Is security enabled: $EZMQ_WITH_SECURITY${NO_COLOUR}"
+    echo -e "${GREEN}Is compression enabled: $EZMQ_WITH_COMPRESSION${NO_COLOUR}"
+    echo -e "${GREEN}Is PGO enabled: $EZMQ_WITH_PGO${NO_COLOUR}"
 
     if [ ${EZMQ_WITH_DEP} = true ]; then
         install_dependencies
@@ -226,6 +250,17 @@ build() {
     if [ "debug" = ${EZMQ_BUILD_MODE} ]; then
         RELEASE="0"
         LOGGING=true
+    elif [ "perf" = ${EZMQ_BUILD_MODE} ]; then
+        BUILD_PROFILE="perf"
+    fi
+
+    if [ ${EZMQ_WITH_COMPRESSION} = true ]; then
+        COMPRESSION="1"
+    fi
+
+    if [ ${EZMQ_WITH_PGO} = true ] && [ "perf" != ${EZMQ_BUILD_MODE} ]; then
+        echo -e "${RED}--with_pgo requires --build_mode=perf${NO_COLOUR}"
+        exit 1
     fi
     
     if [ ${EZMQ_WITH_SECURITY} = false ]; then
@@ -282,6 +317,22 @@ process_cmd_args() {
                 EZMQ_BUILD_MODE="${1#*=}";
                 shift 1;
                 ;;
+            --with_compression=*)
+                EZMQ_WITH_COMPRESSION="${1#*=}";
+                if [ ${EZMQ_WITH_COMPRESSION} != true ] && [ ${EZMQ_WITH_COMPRESSION} != false ]; then
+                    echo -e "${RED}Unknown option for --with_compression${NO_COLOUR}"
+                    shift 1; exit 0
+                fi
+                shift 1;
+                ;;
+            --with_pgo=*)
+                EZMQ_WITH_PGO="${1#*=}";
+                if [ ${EZMQ_WITH_PGO} != true ] && [ ${EZMQ_WITH_PGO} != false ]; then
+                    echo -e "${RED}Unknown option for --with_pgo${NO_COLOUR}"
+                    shift 1; exit 0
+                fi
+                shift 1;
+                ;;
             --with_security=*)
                 EZMQ_WITH_SECURITY="${1#*=}";
                 if [ ${EZMQ_WITH_SECURITY} != true ] && [ ${EZMQ_WITH_SECURITY} != false ]; then
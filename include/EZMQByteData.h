@@ -39,6 +39,7 @@ namespace ezmq
         public:
             friend class EZMQSubscriber;
             friend class EZMQPublisher;
+            friend class EZMQOwnedByteData;
 
             /**
              * Construtor for EZMQByteData.
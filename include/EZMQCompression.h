@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+  * @file   EZMQCompression.h
+  *
+  * @brief This file provides payload compression codecs used by publisher and subscriber.
+  */
+
+#ifndef EZMQ_COMPRESSION_H
+#define EZMQ_COMPRESSION_H
+
+#include <string>
+#include <vector>
+
+#include "EZMQErrorCodes.h"
+
+namespace ezmq
+{
+    /**
+    * @enum EZMQCompressionCodec
+    * Compression codecs of EZMQ message payload. Codec is carried in reserved
+    * bits of EZMQ header, so only four values are possible.
+    */
+    typedef enum
+    {
+        EZMQ_COMPRESSION_NONE = 0,
+        EZMQ_COMPRESSION_LZ4,
+        EZMQ_COMPRESSION_ZSTD,
+        EZMQ_COMPRESSION_ZSTD_DICT  //zstd with shared dictionary, ID is in zstd frame
+    } EZMQCompressionCodec;
+
+    /**
+    * @class  EZMQCompressionDictionary
+    * @brief   This class represents a trained zstd dictionary, shared by publisher and
+    *               subscribers for compressing small and repetitive messages.
+    *               Dictionary is identified by the ID assigned while training it.
+    */
+    class EZMQCompressionDictionary
+    {
+        public:
+            /**
+            * Construtor for EZMQCompressionDictionary.
+            *
+            * @param dictionary - Trained dictionary content.
+            * @param level - Compression level, 0 for default level of zstd.
+            */
+            EZMQCompressionDictionary(const std::string &dictionary, int level);
+
+            /**
+            * Destructor of EZMQCompressionDictionary.
+            */
+            ~EZMQCompressionDictionary();
+
+            /**
+            * Get ID of dictionary.
+            *
+            * @return ID of dictionary, 0 if dictionary is not valid.
+            */
+            unsigned int getId() const;
+
+        private:
+            friend class EZMQCompression;
+
+            EZMQCompressionDictionary(const EZMQCompressionDictionary &) = delete;
+            EZMQCompressionDictionary &operator=(const EZMQCompressionDictionary &) = delete;
+
+            //zstd digested dictionaries, kept opaque to not expose zstd header
+            void *mCompressionDict;
+            void *mDecompressionDict;
+            unsigned int mId;
+    };
+
+    /**
+    * @class  EZMQCompression
+    * @brief   This class compresses and decompresses EZMQ message payload.
+    *               Compressed payload is original length [4 bytes, network byte order]
+    *               followed by the codec output.
+    */
+    class EZMQCompression
+    {
+        public:
+            /**
+            * Check whether codec is supported by this build.
+            * LZ4 and zstd codecs are supported only when built with COMPRESSION=1.
+            *
+            * @param codec - Codec to be checked.
+            *
+            * @return true if codec is supported.
+            */
+            static bool isSupported(EZMQCompressionCodec codec);
+
+            /**
+            * Compress the data.
+            *
+            * @param codec - Codec to be used.
+            * @param level - Compression level, 0 for default level of codec.
+            *                       For LZ4, level greater than 0 uses LZ4 HC.
+            * @param data - Data to be compressed.
+            * @param size - Size of data.
+            * @param output - Compressed payload.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            */
+            static EZMQErrorCode compress(EZMQCompressionCodec codec, int level,
+                const void *data, size_t size, std::string &output);
+
+            /**
+            * Decompress the payload.
+            *
+            * @param codec - Codec of the payload.
+            * @param data - Compressed payload.
+            * @param size - Size of payload.
+            * @param output - Decompressed data.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            */
+            static EZMQErrorCode decompress(EZMQCompressionCodec codec, const void *data,
+                size_t size, std::string &output);
+
+            /**
+            * Compress the data with zstd using dictionary.
+            *
+            * @param dictionary - Dictionary to be used.
+            * @param data - Data to be compressed.
+            * @param size - Size of data.
+            * @param output - Compressed payload.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            */
+            static EZMQErrorCode compress(const EZMQCompressionDictionary &dictionary,
+                const void *data, size_t size, std::string &output);
+
+            /**
+            * Decompress the payload compressed with dictionary.
+            *
+            * @param dictionary - Dictionary used for compression.
+            * @param data - Compressed payload.
+            * @param size - Size of payload.
+            * @param output - Decompressed data.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            */
+            static EZMQErrorCode decompress(const EZMQCompressionDictionary &dictionary,
+                const void *data, size_t size, std::string &output);
+
+            /**
+            * Get ID of dictionary used for compressing the payload.
+            *
+            * @param data - Compressed payload.
+            * @param size - Size of payload.
+            *
+            * @return ID of dictionary, 0 if payload is not compressed with dictionary.
+            */
+            static unsigned int getDictionaryId(const void *data, size_t size);
+
+            /**
+            * Train zstd dictionary from sample messages.
+            * Samples should be serialized messages as published, for example
+            * Event serialized by SerializeToString.
+            *
+            * @param samples - Sample messages, at least a few hundreds are recommended.
+            * @param capacity - Maximum size of dictionary in bytes [around 100KB is typical].
+            * @param dictionary - Trained dictionary.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            */
+            static EZMQErrorCode trainDictionary(const std::vector<std::string> &samples,
+                size_t capacity, std::string &dictionary);
+    };
+}
+#endif //EZMQ_COMPRESSION_H
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+ /**
+ * @file   EZMQEventBatch.h
+ *
+ * @brief This file contains APIs related to columnar batch message format of Event.
+ */
+
+#ifndef EZMQ_EVENTBATCH_H_
+#define EZMQ_EVENTBATCH_H_
+
+#include <string>
+
+#include "EZMQMessage.h"
+
+namespace ezmq
+{
+    class Event;
+
+    /**
+     * @class  EZMQEventBatch
+     * @brief   This class represents an Event with many readings in columnar format.
+     *               Reading fields are stored column by column: strings are encoded as
+     *               indexes into a dictionary of distinct strings, and timestamps as
+     *               zigzag varint deltas from the previous reading. It is much smaller
+     *               than protobuf Event when readings repeat names and devices.
+     *               Typed values of readings are stored in further columns, only for the
+     *               readings having them.
+     */
+    class EZMQEventBatch : public EZMQMessage
+    {
+        public:
+            friend class EZMQSubscriber;
+            friend class EZMQPublisher;
+
+            /**
+             * Construtor for EZMQEventBatch.
+             */
+            EZMQEventBatch();
+
+            /**
+             * Destructor of EZMQEventBatch.
+             */
+            ~EZMQEventBatch();
+
+            /**
+             * Encode the event in columnar format.
+             *
+             * @param event - Event to be encoded.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success.
+             */
+            EZMQErrorCode setEvent(const Event &event);
+
+            /**
+             * Decode the event from columnar format.
+             *
+             * @param event - Decoded event.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if data is malformed.
+             */
+            EZMQErrorCode getEvent(Event &event) const;
+
+            /**
+             * Get encoded data.
+             *
+             * @return Encoded data.
+             */
+            const std::string &getData() const;
+
+            /**
+             * Set encoded data, for example data stored from getData.
+             * Data is validated while decoding it by getEvent.
+             *
+             * @param data - Encoded data.
+             */
+            void setData(const std::string &data);
+
+        private:
+            std::string mData;
+    };
+}
+
+#endif // EZMQ_EVENTBATCH_H_
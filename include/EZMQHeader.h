@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQHeader.h
+ *
+ * @brief This file contains encoding and decoding of EZMQ header.
+ */
+
+#ifndef EZMQ_HEADER_H_
+#define EZMQ_HEADER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "EZMQErrorCodes.h"
+#include "EZMQCompression.h"
+
+namespace ezmq
+{
+    /**
+    * @enum EZMQHeaderExtension
+    * Extensions of EZMQ header version 2.
+    * Each extension is type [1 byte], length [1 byte] and value, integers are in
+    * network byte order. Decoder skips extensions of unknown type.
+    */
+    typedef enum
+    {
+        EZMQ_EXTENSION_SEQUENCE = 1,    //Publisher ID [4 bytes], sequence number [8 bytes]
+        EZMQ_EXTENSION_TIMESTAMP,    //Publish time, nanoseconds since epoch [8 bytes]
+        EZMQ_EXTENSION_COMPRESSION,    //Compression codec [1 byte], overrides codec bits
+        EZMQ_EXTENSION_SCHEMA_ID    //Application defined schema ID of payload [4 bytes]
+    } EZMQHeaderExtension;
+
+    /**
+     * @class  EZMQHeader
+     * @brief   This class represents EZMQ header frame.
+     *               Version 1 header is a single byte: content type [3 bits], version [3 bits]
+     *               and compression codec [2 bits]. Version 2 header is the same byte followed
+     *               by extensions. Version 1 is written when there is no extension, so
+     *               messages stay decodable by subscribers which only know version 1.
+     *               Decoding does not allocate, values are read in place.
+     */
+    class EZMQHeader
+    {
+        public:
+            /**
+             * Construtor for EZMQHeader.
+             */
+            EZMQHeader();
+
+            /**
+             * Decode header frame.
+             *
+             * @param data - Header frame data.
+             * @param size - Header frame size.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if header is malformed
+             *                                     or its version is not supported.
+             */
+            EZMQErrorCode parse(const void *data, size_t size);
+
+            /**
+             * Get size of encoded header.
+             *
+             * @return Size in bytes.
+             */
+            size_t getSize() const;
+
+            /**
+             * Encode header. Extensions are written in fixed order and have fixed size,
+             * so header can be written again in place after values are changed.
+             *
+             * @param out - Buffer of getSize() bytes.
+             */
+            void write(unsigned char *out) const;
+
+            /**
+             * Version of decoded header, 1 or 2.
+             */
+            int getVersion() const;
+
+            /**
+             * Content type, see EZMQContentType.
+             */
+            int getContentType() const;
+            void setContentType(int contentType);
+
+            /**
+             * Compression codec of payload.
+             */
+            EZMQCompressionCodec getCompressionCodec() const;
+            void setCompressionCodec(EZMQCompressionCodec codec);
+
+            /**
+             * Sequence extension, see EZMQPublisher::setSequenceNumbers.
+             */
+            bool hasSequence() const;
+            uint32_t getPublisherId() const;
+            uint64_t getSequence() const;
+            void setSequence(uint32_t publisherId, uint64_t sequence);
+
+            /**
+             * Timestamp extension, see EZMQPublisher::setPublishTimestamps.
+             */
+            bool hasTimestamp() const;
+            uint64_t getTimestamp() const;
+            void setTimestamp(uint64_t timestamp);
+
+            /**
+             * Schema ID extension, see EZMQMessage::setSchemaId.
+             */
+            bool hasSchemaId() const;
+            uint32_t getSchemaId() const;
+            void setSchemaId(uint32_t schemaId);
+
+        private:
+            int mVersion;
+            int mContentType;
+            EZMQCompressionCodec mCodec;
+            unsigned int mExtensions;
+            uint32_t mPublisherId;
+            uint64_t mSequence;
+            uint64_t mTimestamp;
+            uint32_t mSchemaId;
+    };
+}
+
+#endif // EZMQ_HEADER_H_
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+ /**
+ * @file   EZMQJsonData.h
+ *
+ * @brief This file contains APIs related to JSON message format.
+ */
+
+#ifndef EZMQ_JSONDATA_H_
+#define EZMQ_JSONDATA_H_
+
+#include <string>
+
+#include "EZMQMessage.h"
+
+namespace ezmq
+{
+    class Event;
+
+    /**
+     * @class  EZMQJsonData
+     * @brief   This class represents EZMQ JSON message format.
+     *               Event is encoded to JSON with field names of Event.proto, for example:
+     *               {"id":"id1","created":10,...,"device":"dev1","reading":[{"id":"r1",...}]}
+     *               Typed reading values follow protobuf JSON mapping: lowerCamelCase names,
+     *               int64 as string, bytes as base64 and non-finite doubles as strings.
+     *               Received JSON is not validated by subscriber, so text is parsed only once
+     *               by getEvent() which fails for malformed JSON.
+     */
+    class EZMQJsonData : public EZMQMessage
+    {
+        public:
+            friend class EZMQSubscriber;
+            friend class EZMQPublisher;
+
+            /**
+             * Construtor for EZMQJsonData.
+             *
+             * @param json - JSON text.
+             */
+            explicit EZMQJsonData(const std::string &json);
+
+            /**
+             * Destructor of EZMQJsonData.
+             */
+            ~EZMQJsonData();
+
+            /**
+             * Get JSON text of message.
+             *
+             * @return JSON text.
+             */
+            const std::string &getJson() const;
+
+            /**
+             * Set JSON text of message.
+             *
+             * @param json - JSON text.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if json is not valid.
+             */
+            EZMQErrorCode setJson(const std::string &json);
+
+            /**
+             * Encode Event as JSON text of message.
+             * Event is written directly to JSON text without building a document tree.
+             *
+             * @param event - Event to be encoded.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success.
+             */
+            EZMQErrorCode setEvent(const Event &event);
+
+            /**
+             * Decode JSON text of message as Event.
+             * Unknown fields are ignored and int64 fields can be numbers or strings.
+             *
+             * @param event - Decoded event.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if JSON is not a valid Event.
+             */
+            EZMQErrorCode getEvent(Event &event) const;
+
+            /**
+             * Check whether text is well-formed JSON.
+             *
+             * @param data - JSON text.
+             * @param size - Size of text.
+             *
+             * @return true if text is a valid JSON value.
+             */
+            static bool isValid(const char *data, size_t size);
+
+        private:
+            std::string mJson;
+    };
+}
+
+#endif // EZMQ_JSONDATA_H_
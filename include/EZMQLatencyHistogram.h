@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQLatencyHistogram.h
+ *
+ * @brief This file contains histogram of end-to-end message latencies.
+ */
+
+#ifndef EZMQ_LATENCY_HISTOGRAM_H_
+#define EZMQ_LATENCY_HISTOGRAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ezmq
+{
+    /**
+     * @class  EZMQLatencyHistogram
+     * @brief   This class records latencies in nanoseconds into log-linear buckets,
+     *               in the manner of HDR histogram. Buckets have relative error of about 3%
+     *               over the whole range, so tail percentiles are kept with constant memory.
+     */
+    class EZMQLatencyHistogram
+    {
+        public:
+            /**
+             * Construtor for EZMQLatencyHistogram.
+             */
+            EZMQLatencyHistogram();
+
+            /**
+             * Record a value.
+             *
+             * @param value - Latency in nanoseconds.
+             */
+            void record(uint64_t value);
+
+            /**
+             * Add all values recorded in other histogram.
+             *
+             * @param other - Histogram to be added.
+             */
+            void merge(const EZMQLatencyHistogram &other);
+
+            /**
+             * Remove all recorded values.
+             */
+            void reset();
+
+            /**
+             * Get number of recorded values.
+             *
+             * @return Number of values.
+             */
+            uint64_t getCount() const;
+
+            /**
+             * Get smallest recorded value.
+             *
+             * @return Latency in nanoseconds, 0 if no value is recorded.
+             */
+            uint64_t getMin() const;
+
+            /**
+             * Get largest recorded value.
+             *
+             * @return Latency in nanoseconds, 0 if no value is recorded.
+             */
+            uint64_t getMax() const;
+
+            /**
+             * Get mean of recorded values.
+             *
+             * @return Latency in nanoseconds, 0 if no value is recorded.
+             */
+            double getMean() const;
+
+            /**
+             * Get value at a percentile, for example 50, 99 or 99.9.
+             * Value is the upper bound of its bucket, never above getMax().
+             *
+             * @param percentile - Percentile in range [0, 100], values outside are clamped.
+             *
+             * @return Latency in nanoseconds, 0 if no value is recorded.
+             */
+            uint64_t getPercentile(double percentile) const;
+
+        private:
+            std::vector<uint64_t> mCounts;
+            uint64_t mTotalCount;
+            uint64_t mMin;
+            uint64_t mMax;
+            double mSum;
+
+            static size_t getBucket(uint64_t value);
+            static uint64_t getBucketUpperBound(size_t bucket);
+    };
+}
+
+#endif // EZMQ_LATENCY_HISTOGRAM_H_
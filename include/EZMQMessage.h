@@ -25,6 +25,7 @@
 #define EZMQ_MESSAGE_H_
 
 #include <iostream>
+#include <stdint.h>
 
 #include "EZMQErrorCodes.h"
 
@@ -39,7 +40,9 @@ namespace ezmq
         EZMQ_CONTENT_TYPE_PROTOBUF = 0,
         EZMQ_CONTENT_TYPE_BYTEDATA,
         EZMQ_CONTENT_TYPE_AML,  //Not in use as of now
-        EZMQ_CONTENT_TYPE_JSON  //Not in use as of now
+        EZMQ_CONTENT_TYPE_JSON,
+        EZMQ_CONTENT_TYPE_EVENT_BATCH,   //Columnar Event, see EZMQEventBatch
+        EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA   //Multi-segment byte data, see EZMQSegmentedByteData
     } EZMQContentType;
 
     /**
@@ -52,6 +55,11 @@ namespace ezmq
             friend class EZMQSubscriber;
             friend class EZMQPublisher;
 
+            /**
+             * Construtor for EZMQMessage.
+             */
+            EZMQMessage();
+
             virtual ~EZMQMessage() = default;
 
             /**
@@ -72,6 +80,22 @@ namespace ezmq
              */
             EZMQErrorCode setContentType(EZMQContentType type);
 
+            /**
+             * Get schema ID of EZMQMessage.
+             *
+             * @return Schema ID, 0 if message has no schema ID.
+             */
+            uint32_t getSchemaId() const;
+
+            /**
+             * Set application defined schema ID of payload, for example to tell versions
+             * of a JSON or byte data layout apart. It is sent in EZMQ header and set on
+             * received message.
+             *
+             * @param schemaId - Schema ID, 0 to send no schema ID.
+             */
+            void setSchemaId(uint32_t schemaId);
+
         protected:
             /**
              * Get version of EZMQ message format.
@@ -82,6 +106,7 @@ namespace ezmq
 
             int mVersion;
             EZMQContentType mContentType;
+            uint32_t mSchemaId;
     };
 }
 
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQMetrics.h
+ *
+ * @brief This file contains metrics of publisher and subscriber.
+ */
+
+#ifndef EZMQ_METRICS_H_
+#define EZMQ_METRICS_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EZMQErrorCodes.h"
+
+// Number of counter shards per topic
+#define EZMQ_METRIC_SHARDS (8)
+
+namespace ezmq
+{
+    /**
+    * @enum EZMQMetric
+    * Metrics counted per topic. Times are in nanoseconds.
+    */
+    typedef enum
+    {
+        EZMQ_METRIC_MESSAGES_SENT = 0,
+        EZMQ_METRIC_BYTES_SENT,    //All frames including topic and header
+        EZMQ_METRIC_SEND_FAILURES,
+        EZMQ_METRIC_SERIALIZATION_TIME,    //Serialization and compression on publish
+        EZMQ_METRIC_MESSAGES_RECEIVED,
+        EZMQ_METRIC_BYTES_RECEIVED,    //All frames including topic and header
+        EZMQ_METRIC_CALLBACK_TIME,    //Application callback on receive
+        EZMQ_METRIC_COUNT
+    } EZMQMetric;
+
+    /**
+     * @class  EZMQMetrics
+     * @brief   This class keeps counters of a publisher or subscriber socket per topic.
+     *               Each topic has EZMQ_METRIC_SHARDS shards of counters on separate
+     *               cache lines, a thread counts in its own shard and reads sum all
+     *               shards. Threads share a shard only if more than EZMQ_METRIC_SHARDS
+     *               threads count. Shard of last used topic is cached per thread, so
+     *               counting messages of same topic takes no lock and no hashing.
+     *               Counting can be disabled at run time.
+     *
+     * @note Prometheus text is produced by toPrometheus() and writePrometheus().
+     *       Serving it over HTTP for scraping is left to the application.
+     */
+    class EZMQMetrics
+    {
+        public:
+            /**
+             * Construtor for EZMQMetrics.
+             *
+             * @param socket - Label of socket in Prometheus output, e.g. "pub:5562".
+             */
+            EZMQMetrics(const std::string &socket);
+
+            /**
+             * Add value to a counter of topic.
+             *
+             * @param topic - Topic, empty topic for messages without topic.
+             * @param metric - Metric to be counted.
+             * @param value - Value to be added.
+             */
+            void add(const std::string &topic, EZMQMetric metric, uint64_t value);
+
+            /**
+             * Add values to counters of topic, topic is resolved once for all values.
+             * For example: add(topic, {{EZMQ_METRIC_MESSAGES_SENT, 1}, {EZMQ_METRIC_BYTES_SENT, 10}})
+             *
+             * @param topic - Topic, empty topic for messages without topic.
+             * @param values - Metrics and values to be added.
+             */
+            void add(const std::string &topic, std::initializer_list<std::pair<EZMQMetric, uint64_t>> values);
+
+            /**
+             * Enable/Disable counting. Counters are kept while disabled.
+             *
+             * @param enable - true to count [default], false to ignore added values.
+             */
+            void setEnabled(bool enable);
+
+            /**
+             * Check whether counting is enabled.
+             *
+             * @return true if enabled.
+             */
+            bool isEnabled() const;
+
+            /**
+             * Get a counter summed over all topics.
+             *
+             * @param metric - Metric to be read.
+             *
+             * @return Value of counter.
+             */
+            uint64_t getValue(EZMQMetric metric) const;
+
+            /**
+             * Get a counter of topic.
+             *
+             * @param metric - Metric to be read.
+             * @param topic - Topic, empty topic for messages without topic.
+             *
+             * @return Value of counter, 0 if topic is not counted yet.
+             */
+            uint64_t getValue(EZMQMetric metric, const std::string &topic) const;
+
+            /**
+             * Get topics counted so far, since last reset.
+             *
+             * @return Topics in sorted order.
+             */
+            std::vector<std::string> getTopics() const;
+
+            /**
+             * Reset all counters.
+             */
+            void reset();
+
+            /**
+             * Get counters in Prometheus text exposition format, labeled with socket and
+             * topic. Output can be served to Prometheus over a socket.
+             *
+             * @return Prometheus text.
+             */
+            std::string toPrometheus() const;
+
+            /**
+             * Write counters in Prometheus text exposition format to a file, e.g. for
+             * textfile collector of node exporter. File is replaced atomically.
+             *
+             * @param path - Path of file.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode writePrometheus(const std::string &path) const;
+
+            /**
+             * @class  ScopeTimer
+             * @brief   Adds time elapsed in its scope to a time counter.
+             *               Counter is resolved on construction, nothing is timed while
+             *               counting is disabled.
+             */
+            class ScopeTimer
+            {
+                public:
+                    ScopeTimer(EZMQMetrics &metrics, const std::string &topic, EZMQMetric metric);
+                    ~ScopeTimer();
+
+                private:
+                    std::atomic<uint64_t> *mCounter;
+                    std::chrono::steady_clock::time_point mStart;
+            };
+
+        private:
+            typedef std::vector<uint64_t> Counters;
+
+            // Padded so counters of two shards never share a cache line
+            struct Shard
+            {
+                std::atomic<uint64_t> counters[EZMQ_METRIC_COUNT];
+                char padding[128 - EZMQ_METRIC_COUNT * sizeof(std::atomic<uint64_t>)];
+            };
+
+            struct Slot
+            {
+                Slot();
+                uint64_t sum(size_t metric) const;
+                Shard shards[EZMQ_METRIC_SHARDS];
+            };
+
+            EZMQMetrics(const EZMQMetrics &) = delete;
+            EZMQMetrics &operator=(const EZMQMetrics &) = delete;
+
+            std::string mSocket;
+            // Identifies this instance in per-thread slot caches, never reused
+            uint64_t mId;
+            std::atomic<bool> mEnabled;
+            mutable std::mutex mLock;
+            std::unordered_map<std::string, std::unique_ptr<Slot>> mSlots;
+
+            std::atomic<uint64_t> *getCounters(const std::string &topic);
+            std::map<std::string, Counters> collect() const;
+    };
+}
+
+#endif // EZMQ_METRICS_H_
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+ /**
+ * @file   EZMQOwnedByteData.h
+ *
+ * @brief This file contains APIs related to byte data message which owns its buffer.
+ */
+
+#ifndef EZMQ_OWNED_BYTEDATA_H_
+#define EZMQ_OWNED_BYTEDATA_H_
+
+#include <memory>
+#include <string>
+
+#include "zmq.hpp"
+
+#include "EZMQByteData.h"
+
+namespace ezmq
+{
+    /**
+     * @class  EZMQOwnedByteData
+     * @brief   This class represents EZMQ byte data message which keeps its buffer alive.
+     *          Subscriber delivers byte data as EZMQOwnedByteData adopting the received
+     *          zmq message, so payload can be retained after callback without copy.
+     *          It is move-only, use share() to get another owner of the same buffer.
+     */
+    class EZMQOwnedByteData : public EZMQByteData
+    {
+        public:
+            friend class EZMQSubscriber;
+            friend class EZMQPublisher;
+
+            /**
+             * Construtor for empty EZMQOwnedByteData.
+             */
+            EZMQOwnedByteData();
+
+            /**
+             * Construtor for EZMQOwnedByteData adopting a zmq message.
+             *
+             * @param message - Message to be adopted, it is left empty.
+             */
+            explicit EZMQOwnedByteData(zmq::message_t &&message);
+
+            /**
+             * Construtor for EZMQOwnedByteData adopting a string buffer.
+             *
+             * @param data - Buffer to be adopted, it is left empty.
+             */
+            explicit EZMQOwnedByteData(std::string &&data);
+
+            /**
+             * Construtor for EZMQOwnedByteData sharing a refcounted buffer.
+             *
+             * @param owner - Buffer owner, kept alive as long as this message.
+             * @param data - Byte data inside the buffer.
+             * @param dataLength - Data length.
+             */
+            EZMQOwnedByteData(const std::shared_ptr<const void> &owner, const uint8_t *data,
+                    size_t dataLength);
+
+            EZMQOwnedByteData(EZMQOwnedByteData &&other);
+            EZMQOwnedByteData &operator=(EZMQOwnedByteData &&other);
+            EZMQOwnedByteData(const EZMQOwnedByteData &) = delete;
+            EZMQOwnedByteData &operator=(const EZMQOwnedByteData &) = delete;
+
+            /**
+             * Destructor of EZMQOwnedByteData.
+             */
+            ~EZMQOwnedByteData();
+
+            /**
+             * Get another owner of the same buffer.
+             * Data is not copied.
+             *
+             * @return EZMQOwnedByteData sharing the buffer.
+             */
+            EZMQOwnedByteData share() const;
+
+            /**
+             * Set byte data.
+             * Data is copied into a buffer owned by this message.
+             *
+             * @param data - Byte data.
+             * @param dataLength - Data length.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode setByteData(const uint8_t * data, size_t dataLength);
+
+        private:
+            void reset();
+
+            std::shared_ptr<const void> mOwner;
+    };
+}
+
+#endif // EZMQ_OWNED_BYTEDATA_H_
@@ -25,7 +25,11 @@
 #define EZMQ_PUBLISHER_H
 
 #include <list>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 //Protobuf header file
 #include "Event.pb.h"
@@ -35,6 +39,10 @@
 
 #include "EZMQMessage.h"
 #include "EZMQErrorCodes.h"
+#include "EZMQCompression.h"
+#include "EZMQMetrics.h"
+#include "EZMQSocketMonitor.h"
+#include "EZMQTopicTrie.h"
 
 namespace ezmq
 {
@@ -73,6 +81,14 @@ namespace ezmq
              * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
              */
             virtual void onErrorCB(EZMQErrorCode /*errorCode*/) {};
+
+            /**
+             * Invoked on connection event of PUB socket, if socket monitor is enabled.
+             *
+             * @param event - Socket event.
+             * @param address - Address of peer or endpoint.
+             */
+            virtual void onSocketEventCB(EZMQSocketEvent /*event*/, const std::string &/*address*/) {};
     };
 
     /**
@@ -121,6 +137,152 @@ namespace ezmq
             */
             EZMQErrorCode setServerPrivateKey(const std::string& key);
 
+            /**
+            * Enable/Disable the last value cache of publisher.
+            * When enabled, publisher keeps the last published message of every topic and
+            * sends it again as soon as a new subscriber subscribes for that topic, so a late
+            * joining subscriber immediately receives the current state.
+            *
+            * @param enable - true to enable last value cache, false to disable.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Cached message is sent on the publisher socket, so other subscribers of
+            *      same topic will also receive it again.
+            */
+            EZMQErrorCode setLastValueCache(bool enable);
+
+            /**
+            * Enable/Disable skipping of topics which are not subscribed by any subscriber.
+            * When enabled, publisher tracks the live subscriptions of its subscribers and
+            * publish APIs return EZMQ_OK without serializing or sending the event, if no
+            * subscriber is subscribed for the topic.
+            *
+            * @param enable - true to skip unwatched topics, false to publish all topics.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Subscriptions are tracked asynchronously, so events published immediately
+            *      after a subscriber subscribes may be skipped. <br>
+            * (3) Topics are not skipped when last value cache is enabled, as cache
+            *      needs every published event.
+            */
+            EZMQErrorCode setSkipUnwatchedTopics(bool enable);
+
+            /**
+            * Set compression policy of publisher. Payload of every published event whose size
+            * is at least the threshold is compressed with the codec, and subscriber decompresses
+            * it transparently. Payload is sent uncompressed if compression does not shrink it.
+            *
+            * @param codec - Compression codec, EZMQ_COMPRESSION_NONE to disable compression.
+            * @param level - Compression level, 0 for default level of codec.
+            * @param threshold - Minimum payload size in bytes to be compressed.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) LZ4 and zstd codecs are available only if EZMQ is built with COMPRESSION=1. <br>
+            * (3) Subscriber should also be built with support of the codec.
+            */
+            EZMQErrorCode setCompression(EZMQCompressionCodec codec, int level, size_t threshold);
+
+            /**
+            * Set zstd dictionary used by EZMQ_COMPRESSION_ZSTD_DICT codec.
+            * Dictionary ID is carried in every compressed message, subscribers should
+            * add the same dictionary to decompress it.
+            *
+            * @param dictionary - Trained dictionary, its level is used instead of level
+            *                              given in setCompression API.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Without dictionary, EZMQ_COMPRESSION_ZSTD_DICT codec sends messages uncompressed.
+            */
+            EZMQErrorCode setCompressionDictionary(std::shared_ptr<EZMQCompressionDictionary> dictionary);
+
+            /**
+            * Enable/Disable sequence numbers of published messages.
+            * When enabled, every message carries a random id of this publisher and a sequence
+            * number incremented per topic, so subscriber can detect dropped messages.
+            *
+            * @param enable - true to enable sequence numbers, false to disable.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Sequence numbers are sent in EZMQ header extension, see EZMQHeader.
+            *      Subscribers which do not know the extension still receive messages as usual. <br>
+            * (3) Sequences are kept for up to 1024 topics. Publishing a further topic restarts
+            *      all sequences with a new publisher id, subscribers miss gaps only at restart.
+            */
+            EZMQErrorCode setSequenceNumbers(bool enable);
+
+            /**
+            * Enable/Disable publish timestamps of published messages.
+            * When enabled, every message carries wall clock time at which it was sent,
+            * so subscriber can measure end-to-end latency, see EZMQSubscriber::getLatencyHistogram.
+            *
+            * @param enable - true to enable timestamps, false to disable.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Clocks of publisher and subscriber hosts should be synchronized, e.g. by PTP or NTP.
+            *      Latency on the same host needs no synchronization. <br>
+            * (3) Timestamps are sent in EZMQ header extension, see EZMQHeader.
+            */
+            EZMQErrorCode setPublishTimestamps(bool enable);
+
+            /**
+            * Enable/Disable monitoring of connection events of publisher socket, such as
+            * accepted and disconnected subscribers and failed handshakes.
+            *
+            * @param enable - true to enable monitoring, false to disable.
+            * @param callback - Callback for events, invoked on monitor thread. If null,
+            *                          onSocketEventCB of EZMQPUBCallback is invoked, if given.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Events are counted even without callback, see getSocketEventCount.
+            */
+            EZMQErrorCode setSocketMonitor(bool enable, EZMQSocketEventCB callback = nullptr);
+
+            /**
+            * Get number of connection events of a type, counted while socket monitor is enabled.
+            *
+            * @param event - Socket event.
+            *
+            * @return Number of events.
+            */
+            uint64_t getSocketEventCount(EZMQSocketEvent event);
+
+            /**
+            * Check whether any subscriber is subscribed for the given topic.
+            *
+            * @param topic - Topic to be checked. Empty topic checks for subscribers of
+            *                       events published without topic.
+            *
+            * @return true if there is a subscriber for the topic or subscriptions are not
+            *              tracked, false otherwise.
+            *
+            * @note
+            * (1) Subscriptions are tracked only when setSkipUnwatchedTopics or
+            *      setLastValueCache is enabled, otherwise it always returns true. <br>
+            * (2) Topic name should be as path format. For example: home/livingroom/
+            */
+            bool hasSubscribers(std::string topic);
+
             /**
             * Starts PUB instance.
             *
@@ -181,6 +343,14 @@ namespace ezmq
             */
             int getPort();
 
+            /**
+            * Get metrics of this publisher: messages and bytes sent, send failures and
+            * serialization time, per topic.
+            *
+            * @return Metrics of publisher.
+            */
+            EZMQMetrics &getMetrics();
+
         private:
             int mPort;
             std::string mServerSecretKey;
@@ -195,11 +365,60 @@ namespace ezmq
             zmq::socket_t *mPublisher;
             std::shared_ptr<zmq::context_t> mContext;
 
+            // ZMQ shut-down sockets
+            zmq::socket_t *mShutdownServer;
+            zmq::socket_t *mShutdownClient;
+
+            // ZMQ poller
+            std::vector<zmq::pollitem_t> mPollItems;
+
+            //Subscription receiver thread
+            std::thread mThread;
+            bool isReceiverStarted;
+
+            //Last value cache [topic -> header, data frames]
+            bool mLastValueCacheEnabled;
+            std::map<std::string, std::vector<std::string>> mLastValueCache;
+
+            //Live subscription prefixes of subscribers
+            bool mSkipUnwatchedTopics;
+            EZMQTopicTrie mSubscriptions;
+            std::mutex mSubscriptionLock;
+
+            //Compression policy
+            EZMQCompressionCodec mCompressionCodec;
+            int mCompressionLevel;
+            size_t mCompressionThreshold;
+            std::shared_ptr<EZMQCompressionDictionary> mCompressionDictionary;
+
+            //Sequence numbers [topic -> last sequence]
+            bool mSequenceEnabled;
+            uint32_t mPublisherId;
+            std::map<std::string, uint64_t> mSequences;
+
+            //Publish timestamps
+            bool mTimestampEnabled;
+
+            EZMQMetrics mMetrics;
+
+            //Socket monitor
+            bool mSocketMonitorEnabled;
+            EZMQSocketEventCB mSocketEventCallback;
+            EZMQSocketMonitor mSocketMonitor;
+
             //Mutex
             std::recursive_mutex mPubLock;
 
             EZMQErrorCode publishInternal(std::string &topic, const EZMQMessage &event);
+            bool isSubscriptionAware();
+            EZMQErrorCode startReceiver();
+            void stopReceiver();
+            void receive();
+            void handleSubscriptions();
+            void sendLastValues(const std::string &prefix);
+            bool isWatched(const std::string &topic);
             std::string getSocketAddress();
+            std::string getInProcUniqueAddress();
             std::string  sanitizeTopic(std::string &topic);
             EZMQErrorCode syncClose();
     };
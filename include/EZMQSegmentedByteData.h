@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+ /**
+ * @file   EZMQSegmentedByteData.h
+ *
+ * @brief This file contains APIs related to multi-segment byte data message format.
+ */
+
+#ifndef EZMQ_SEGMENTED_BYTEDATA_H_
+#define EZMQ_SEGMENTED_BYTEDATA_H_
+
+#include <vector>
+
+#include "EZMQOwnedByteData.h"
+
+namespace ezmq
+{
+    /**
+     * @class  EZMQSegmentedByteData
+     * @brief   This class represents byte data made of several segments, for example a
+     *               header and image planes living in separate buffers. Each segment is
+     *               sent as its own frame, so segments are never gathered into one buffer.
+     *               Subscriber delivers received segments adopting their frames.
+     */
+    class EZMQSegmentedByteData : public EZMQMessage
+    {
+        public:
+            friend class EZMQSubscriber;
+            friend class EZMQPublisher;
+
+            /**
+             * Construtor for EZMQSegmentedByteData.
+             */
+            EZMQSegmentedByteData();
+
+            EZMQSegmentedByteData(EZMQSegmentedByteData &&other) = default;
+            EZMQSegmentedByteData &operator=(EZMQSegmentedByteData &&other) = default;
+            EZMQSegmentedByteData(const EZMQSegmentedByteData &) = delete;
+            EZMQSegmentedByteData &operator=(const EZMQSegmentedByteData &) = delete;
+
+            /**
+             * Destructor of EZMQSegmentedByteData.
+             */
+            ~EZMQSegmentedByteData();
+
+            /**
+             * Add a segment referring to data.
+             * Data is not owned, it should outlive this message.
+             * It is copied into its frame on publish.
+             *
+             * @param data - Byte data.
+             * @param dataLength - Data length.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode addSegment(const uint8_t *data, size_t dataLength);
+
+            /**
+             * Add a segment owning its buffer.
+             * It is published without copy, buffer is released once it is sent.
+             *
+             * @param segment - Segment to be added.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode addSegment(EZMQOwnedByteData &&segment);
+
+            /**
+             * Get number of segments.
+             *
+             * @return Number of segments.
+             */
+            size_t getSegmentCount() const;
+
+            /**
+             * Get a segment. Use share() of segment to retain it.
+             *
+             * @param index - Index of segment, less than getSegmentCount().
+             *
+             * @return Segment.
+             */
+            const EZMQOwnedByteData &getSegment(size_t index) const;
+
+            /**
+             * Get total length of all segments.
+             *
+             * @return Length of data.
+             */
+            size_t getLength() const;
+
+            /**
+             * Remove all segments.
+             */
+            void clear();
+
+        private:
+            std::vector<EZMQOwnedByteData> mSegments;
+    };
+}
+
+#endif // EZMQ_SEGMENTED_BYTEDATA_H_
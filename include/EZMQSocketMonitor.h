@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQSocketMonitor.h
+ *
+ * @brief This file contains monitoring of connection events of a ZMQ socket.
+ */
+
+#ifndef EZMQ_SOCKET_MONITOR_H_
+#define EZMQ_SOCKET_MONITOR_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+//ZeroMQ header file
+#include "zmq.hpp"
+
+#include "EZMQErrorCodes.h"
+
+namespace ezmq
+{
+    /**
+    * @enum EZMQSocketEvent
+    * Connection events of publisher and subscriber sockets.
+    */
+    typedef enum
+    {
+        EZMQ_SOCKET_EVENT_CONNECTED = 0,
+        EZMQ_SOCKET_EVENT_CONNECT_DELAYED,
+        EZMQ_SOCKET_EVENT_CONNECT_RETRIED,
+        EZMQ_SOCKET_EVENT_LISTENING,
+        EZMQ_SOCKET_EVENT_BIND_FAILED,
+        EZMQ_SOCKET_EVENT_ACCEPTED,
+        EZMQ_SOCKET_EVENT_ACCEPT_FAILED,
+        EZMQ_SOCKET_EVENT_CLOSED,
+        EZMQ_SOCKET_EVENT_CLOSE_FAILED,
+        EZMQ_SOCKET_EVENT_DISCONNECTED,
+        EZMQ_SOCKET_EVENT_HANDSHAKE_SUCCEEDED,
+        EZMQ_SOCKET_EVENT_HANDSHAKE_FAILED,    //Protocol or security handshake failed
+        EZMQ_SOCKET_EVENT_COUNT
+    } EZMQSocketEvent;
+
+    /**
+    * Callback to get connection events of a socket.
+    * It is invoked on monitor thread of the socket.
+    */
+    typedef std::function<void(EZMQSocketEvent event, const std::string &address)> EZMQSocketEventCB;
+
+    /**
+     * @class  EZMQSocketMonitor
+     * @brief   This class monitors a ZMQ socket on its own thread, counts its connection
+     *               events and reports them to a callback. Frequent disconnects and connect
+     *               retries point to a flapping link.
+     */
+    class EZMQSocketMonitor
+    {
+        public:
+            /**
+             * Construtor for EZMQSocketMonitor.
+             */
+            EZMQSocketMonitor();
+
+            /**
+             * Destructor of EZMQSocketMonitor, it stops monitoring.
+             */
+            ~EZMQSocketMonitor();
+
+            /**
+             * Start monitoring socket. It should be started before socket is bound or
+             * connected, so that first events are not missed.
+             *
+             * @param socket - Socket to be monitored.
+             * @param callback - Callback for events, can be null to only count them.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode start(zmq::socket_t &socket, EZMQSocketEventCB callback);
+
+            /**
+             * Stop monitoring. It should be called before socket is closed.
+             */
+            void stop();
+
+            /**
+             * Get number of events of a type since construction.
+             *
+             * @param event - Event type.
+             *
+             * @return Number of events.
+             */
+            uint64_t getEventCount(EZMQSocketEvent event) const;
+
+        private:
+            class Monitor;
+
+            EZMQSocketMonitor(const EZMQSocketMonitor &) = delete;
+            EZMQSocketMonitor &operator=(const EZMQSocketMonitor &) = delete;
+
+            std::unique_ptr<Monitor> mMonitor;
+            std::thread mThread;
+            std::atomic<bool> mRunning;
+            EZMQSocketEventCB mCallback;
+            std::atomic<uint64_t> mCounts[EZMQ_SOCKET_EVENT_COUNT];
+
+            void run();
+            void onEvent(EZMQSocketEvent event, const char *address);
+    };
+}
+
+#endif // EZMQ_SOCKET_MONITOR_H_
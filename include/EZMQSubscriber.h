@@ -24,7 +24,10 @@
 #ifndef EZMQ_SUBSCRIBER_H
 #define EZMQ_SUBSCRIBER_H
 
+#include <atomic>
 #include <list>
+#include <map>
+#include <memory>
 #include <thread>
 #include <mutex>
 
@@ -36,11 +39,18 @@
 
 #include "EZMQErrorCodes.h"
 #include "EZMQMessage.h"
+#include "EZMQTopicTrie.h"
+#include "EZMQCompression.h"
+#include "EZMQLatencyHistogram.h"
+#include "EZMQHeader.h"
+#include "EZMQMetrics.h"
+#include "EZMQSocketMonitor.h"
 
 namespace ezmq
 {
     /**
     * Callbacks to get all the subscribed events.
+    * Byte data is delivered as EZMQOwnedByteData, use share() to retain it after callback.
     */
     typedef std::function<void(const EZMQMessage &event)> EZMQSubCB;
 
@@ -70,6 +80,14 @@ namespace ezmq
              * @param event - Received message.
              */
             virtual void onMessageCB(const std::string &/*topic*/, const EZMQMessage &/*event*/) {}
+
+            /**
+             * Invoked on connection event of SUB socket, if socket monitor is enabled.
+             *
+             * @param event - Socket event.
+             * @param address - Address of publisher.
+             */
+            virtual void onSocketEventCB(EZMQSocketEvent /*event*/, const std::string &/*address*/) {}
     };
 
     /**
@@ -148,6 +166,112 @@ namespace ezmq
             */
             EZMQErrorCode setServerPublicKey(const std::string& key);
 
+            /**
+            * Add zstd dictionary for decompressing messages published with
+            * EZMQ_COMPRESSION_ZSTD_DICT codec. Dictionaries are looked up by the dictionary ID
+            * carried in message, so multiple dictionaries can be added while publishers
+            * move to a newly trained dictionary.
+            *
+            * @param dictionary - Trained dictionary, same as used by publisher.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) Adding dictionary with same ID replaces the existing one.
+            */
+            EZMQErrorCode addCompressionDictionary(std::shared_ptr<EZMQCompressionDictionary> dictionary);
+
+            /**
+            * Get number of messages dropped before reaching this subscriber.
+            * Drops are detected from gaps in sequence numbers, tracked per publisher and topic.
+            *
+            * @return Number of dropped messages of all topics.
+            *
+            * @note
+            * (1) Only messages of publishers with sequence numbers enabled are tracked,
+            *      see EZMQPublisher::setSequenceNumbers. <br>
+            * (2) Number of tracked [publisher, topic] pairs is limited, least recently received
+            *      ones are forgotten first. Gap before first message after that is not counted.
+            */
+            uint64_t getDroppedCount();
+
+            /**
+            * Get number of messages dropped for a topic before reaching this subscriber.
+            *
+            * @param topic - Topic of messages, empty topic for messages published without topic.
+            *
+            * @return Number of dropped messages of the topic.
+            *
+            * @note Drops are counted per topic for first 64 topics with drops only, drops of
+            *       further topics are counted only in getDroppedCount().
+            */
+            uint64_t getDroppedCount(const std::string &topic);
+
+            /**
+            * Get number of received messages rejected as malformed, e.g. with missing or
+            * unexpected frames, empty topic, invalid EZMQ header or unsupported content type.
+            *
+            * @return Number of rejected messages.
+            */
+            uint64_t getRejectedCount();
+
+            /**
+            * Enable/Disable monitoring of connection events of subscriber socket, such as
+            * connects, disconnects, connect retries and failed handshakes.
+            *
+            * @param enable - true to enable monitoring, false to disable.
+            * @param callback - Callback for events, invoked on monitor thread. If null,
+            *                          onSocketEventCB of EZMQSUBCallback is invoked, if given.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) This API should be called before start() API. <br>
+            * (2) Events are counted even without callback, see getSocketEventCount.
+            */
+            EZMQErrorCode setSocketMonitor(bool enable, EZMQSocketEventCB callback = nullptr);
+
+            /**
+            * Get number of connection events of a type, counted while socket monitor is enabled.
+            *
+            * @param event - Socket event.
+            *
+            * @return Number of events.
+            */
+            uint64_t getSocketEventCount(EZMQSocketEvent event);
+
+            /**
+            * Get histogram of end-to-end latencies of a topic, from publish until message
+            * is parsed and handed to the application callback.
+            *
+            * @param topic - Topic of messages, empty topic for messages published without topic.
+            * @param histogram - [out] Copy of latencies recorded so far, in nanoseconds.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if no latency is recorded for topic.
+            *
+            * @note
+            * (1) Only messages of publishers with timestamps enabled are measured,
+            *      see EZMQPublisher::setPublishTimestamps. <br>
+            * (2) Latency is clamped to zero if clock of publisher host is ahead. <br>
+            * (3) Histograms are kept for first 64 topics only, latencies of further topics are
+            *      recorded only in histogram of all topics.
+            */
+            EZMQErrorCode getLatencyHistogram(const std::string &topic, EZMQLatencyHistogram &histogram);
+
+            /**
+            * Get histogram of end-to-end latencies of all topics.
+            *
+            * @param histogram - [out] Copy of latencies recorded so far, in nanoseconds.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, EZMQ_ERROR if no latency is recorded.
+            */
+            EZMQErrorCode getLatencyHistogram(EZMQLatencyHistogram &histogram);
+
+            /**
+            * Remove all recorded latencies of all topics.
+            */
+            void resetLatencyHistograms();
+
             /**
             * Starts SUB  instance.
             *
@@ -171,7 +295,11 @@ namespace ezmq
             *
             * @note
             * (1) Topic name should be as path format. For example: home/livingroom/<br>
-            * (2) Topic name can have letters [a-z, A-z], numerics [0-9] and special characters _ - . and /
+            * (2) Topic name can have letters [a-z, A-z], numerics [0-9] and special characters _ - . and / <br>
+            * (3) Topic level can be wildcard: '+' matches one level and '#' [only as last level] matches
+            *     any number of levels. For example: home/+/light/ or home/#. Wildcard topic matches whole
+            *     topic, other topics match as prefix. <br>
+            * (4) Subscribing again on same topic has no effect, single un-subscribe removes it.
             */
             EZMQErrorCode subscribe(std::string topic);
 
@@ -190,6 +318,28 @@ namespace ezmq
             */
             EZMQErrorCode subscribe(const std::list<std::string> &topics);
 
+            /**
+            * Subscribe for event/messages on a particular topic and route them to given handler.
+            * Handler is invoked for every received event whose topic starts with the given topic,
+            * instead of subscriber callback. Events not matching any handler are delivered to
+            * subscriber callback.
+            *
+            * @param topic - Topic to be subscribed.
+            * @param handler - Handler to receive events of the topic.
+            *
+            * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+            *
+            * @note
+            * (1) Topic name should be as path format. For example: home/livingroom/<br>
+            * (2) Topic name can have letters [a-z, A-z], numerics [0-9] and special characters _ - . and / <br>
+            * (3) Subscribing again on same topic replaces its handler. <br>
+            * (4) Handler is removed by un-subscribe API with the same topic. <br>
+            * (5) Topic can have wildcard levels, same as subscribe(std::string topic). <br>
+            * (6) Handlers can subscribe and un-subscribe, changes are applied once the received
+            *       event is dispatched.
+            */
+            EZMQErrorCode subscribe(std::string topic, EZMQSubTopicCB handler);
+
             /**
             * Subscribe for event/messages from given IP:Port on the given topic.
             *
@@ -272,6 +422,14 @@ namespace ezmq
             */
             std::string getServiceName();
 
+            /**
+            * Get metrics of this subscriber: messages and bytes received and application
+            * callback time, per topic.
+            *
+            * @return Metrics of subscriber.
+            */
+            EZMQMetrics &getMetrics();
+
         private:
             std::string mServiceName;
             std::string mIp;
@@ -289,6 +447,48 @@ namespace ezmq
             EZMQSubTopicCB mSubTopicCallback;
             EZMQSUBCallback *mCallback;
 
+            //Topic handlers
+            EZMQTopicTrie mTopicHandlers;
+
+            //Handler changes made by handlers during dispatch [topic -> handler, null for removal]
+            bool mDispatching;
+            std::vector<std::pair<std::string, EZMQSubTopicCB>> mPendingHandlers;
+
+            //Subscribed topics, used for filtering wildcard topics
+            EZMQTopicTrie mTopicFilters;
+
+            //Compression dictionaries [dictionary ID -> dictionary]
+            std::map<unsigned int, std::shared_ptr<EZMQCompressionDictionary>> mCompressionDictionaries;
+
+            //Sequence tracking [publisher ID, topic -> last sequence], [topic -> dropped count]
+            //limited number of topics, and total dropped count
+            struct SequenceState
+            {
+                uint64_t sequence;
+                // Value of mTrackedCount when last received, for evicting idle publishers
+                uint64_t lastTracked;
+            };
+            std::map<std::pair<uint32_t, std::string>, SequenceState> mLastSequences;
+            uint64_t mTrackedCount;
+            std::map<std::string, uint64_t> mDroppedCounts;
+            uint64_t mDroppedCount;
+            std::mutex mSequenceLock;
+
+            //Latency tracking [topic -> histogram], limited number of topics, and all topics
+            std::map<std::string, EZMQLatencyHistogram> mLatencies;
+            EZMQLatencyHistogram mAllLatencies;
+            std::mutex mLatencyLock;
+
+            //Number of rejected malformed messages
+            std::atomic<uint64_t> mRejectedCount;
+
+            EZMQMetrics mMetrics;
+
+            //Socket monitor
+            bool mSocketMonitorEnabled;
+            EZMQSocketEventCB mSocketEventCallback;
+            EZMQSocketMonitor mSocketMonitor;
+
             // ZMQ Subscriber socket
             zmq::socket_t * mSubscriber;
             std::shared_ptr<zmq::context_t> mContext;
@@ -310,6 +510,15 @@ namespace ezmq
             std::string getInProcUniqueAddress();
             void receive();
             void parseSocketData();
+            void dispatch(bool isTopic, const std::string &topic, const EZMQMessage &message,
+                const EZMQHeader &header);
+            bool routeToHandlers(const std::string &topic, const EZMQMessage &event);
+            void setTopicHandler(const std::string &topic, EZMQSubTopicCB handler);
+            void trackSequence(const std::string &topic, uint32_t publisherId, uint64_t sequence);
+            void evictIdleSequences();
+            void trackLatency(const std::string &topic, uint64_t timestamp);
+            EZMQErrorCode validateFrames(size_t frameCount, bool hasTopicFrame, const zmq::message_t &topicFrame,
+                const zmq::message_t &headerFrame, EZMQHeader &header);
             std::string  sanitizeTopic(std::string &topic);
             void clearKeys();
     };
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+  * @file   EZMQTopicTrie.h
+  *
+  * @brief This file provides prefix trie of topics, used for routing received events to
+  *            topic handlers.
+  */
+
+#ifndef EZMQ_TOPIC_TRIE_H
+#define EZMQ_TOPIC_TRIE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "EZMQMessage.h"
+
+namespace ezmq
+{
+    /**
+    * @class  EZMQTopicTrie
+    * @brief   This class maps topics to handlers using character prefix trie.
+    *               A handler registered for topic "home/" is matched for every topic
+    *               starting with "home/", same as ZMQ subscription matching.
+    *               Topics having wildcard levels are matched level by level instead:
+    *               '+' matches exactly one level and '#' [last level] matches any number
+    *               of levels. For example "home/+/light/" matches "home/kitchen/light/" but
+    *               not "home/kitchen/light/1/".
+    *               Matching cost depends on topic length only, not on number of handlers.
+    */
+    class EZMQTopicTrie
+    {
+        public:
+            typedef std::function<void(const std::string &topic, const EZMQMessage &event)> Handler;
+            typedef void (*Visitor)(const Handler &handler, void *context);
+
+            EZMQTopicTrie();
+
+            /**
+            * Register handler for topic. Existing handler of same topic is replaced.
+            *
+            * @param topic - Sanitized topic [ends with forward slash], may have wildcard levels.
+            * @param handler - Handler for topic, can be empty for only matching the topic.
+            */
+            void insert(const std::string &topic, const Handler &handler);
+
+            /**
+            * Remove handler of topic.
+            *
+            * @param topic - Sanitized topic [ends with forward slash].
+            *
+            * @return true if handler was removed, false if topic has no handler.
+            */
+            bool erase(const std::string &topic);
+
+            /**
+            * Get handlers of all registered topics which are prefix of given topic.
+            * Topic is matched as if it ends with forward slash.
+            *
+            * @param topic - Received topic.
+            * @param handlers - Matched handlers are appended to it.
+            *
+            * @return Number of matched handlers.
+            */
+            size_t match(const std::string &topic, std::vector<Handler> &handlers) const;
+
+            /**
+            * Invoke visitor for handlers of all registered topics which are prefix of given
+            * topic, without copying the handlers. Trie must not be modified by the visitor.
+            * Topic is matched as if it ends with forward slash.
+            *
+            * @param topic - Received topic.
+            * @param visitor - Invoked for every matched handler.
+            * @param context - Passed to visitor as is.
+            *
+            * @return Number of matched handlers.
+            */
+            size_t match(const std::string &topic, Visitor visitor, void *context) const;
+
+            /**
+            * Check whether topic is registered.
+            *
+            * @param topic - Sanitized topic [ends with forward slash].
+            *
+            * @return true if topic is registered.
+            */
+            bool contains(const std::string &topic) const;
+
+            /**
+            * Check whether any registered topic is a literal prefix of given topic, as
+            * ZMQ matches subscriptions. Unlike match(), characters are compared as is,
+            * wildcards and separators have no special meaning. It does not allocate.
+            *
+            * @param topic - Topic to be checked.
+            *
+            * @return true if a registered topic is prefix of the topic.
+            */
+            bool hasPrefixOf(const std::string &topic) const;
+
+            /**
+            * Get number of registered topics which match the given topic.
+            *
+            * @param topic - Received topic.
+            *
+            * @return Number of matched topics.
+            */
+            size_t count(const std::string &topic) const;
+
+            /**
+            * Check whether trie has any topic with wildcard levels.
+            *
+            * @return true if any registered topic has wildcard.
+            */
+            bool hasWildcards() const;
+
+            /**
+            * Check whether topic has wildcard levels.
+            *
+            * @param topic - Topic to be checked.
+            *
+            * @return true if topic has '+' or '#'.
+            */
+            static bool isWildcard(const std::string &topic);
+
+            /**
+            * Check whether wildcards in topic occupy whole levels and '#' is the last level.
+            *
+            * @param topic - Topic to be validated.
+            *
+            * @return true if topic is valid.
+            */
+            static bool isValidWildcard(const std::string &topic);
+
+            /**
+            * Get the part of topic before its first wildcard level. It can be used as
+            * ZMQ subscription for the topic.
+            *
+            * @param topic - Sanitized topic.
+            *
+            * @return Literal prefix of topic.
+            */
+            static std::string getLiteralPrefix(const std::string &topic);
+
+            /**
+            * Check whether trie has any handler.
+            *
+            * @return true if no handler is registered.
+            */
+            bool empty() const;
+
+            /**
+            * Remove all handlers.
+            */
+            void clear();
+
+        private:
+            struct Node
+            {
+                Node() : isTopic(false), isExact(false) {}
+                std::map<char, std::unique_ptr<Node>> children;
+                Handler handler;
+                bool isTopic;
+                // Wildcard topics match whole topic, others match as prefix
+                bool isExact;
+            };
+
+            Node mRoot;
+            size_t mSize;
+            size_t mWildcards;
+
+            static bool eraseInternal(Node &node, const std::string &topic, size_t index);
+            static size_t getLength(const std::string &topic);
+            static size_t matchInternal(const Node &node, const std::string &topic, size_t length,
+                size_t index, Visitor visitor, void *context);
+            static void appendHandler(const Handler &handler, void *context);
+    };
+}
+#endif //EZMQ_TOPIC_TRIE_H
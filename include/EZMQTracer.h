@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQTracer.h
+ *
+ * @brief This file contains tracing of publish and receive pipeline stages.
+ */
+
+#ifndef EZMQ_TRACER_H_
+#define EZMQ_TRACER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "EZMQErrorCodes.h"
+
+// Max number of trace events kept per thread
+#define EZMQ_MAX_TRACE_EVENTS (1 << 20)
+
+// Trace points are compiled only with EZMQ_TRACING, see the TRACING build option
+#ifdef EZMQ_TRACING
+#define EZMQ_TRACE_SCOPE(var, name) ezmq::EZMQTraceScope var(name)
+#define EZMQ_TRACE_END(var) var.end()
+#else
+#define EZMQ_TRACE_SCOPE(var, name)
+#define EZMQ_TRACE_END(var)
+#endif
+
+namespace ezmq
+{
+    /**
+     * @class  EZMQTracer
+     * @brief   This class records durations of pipeline stages and writes them in
+     *               Chrome trace event format, which can be opened in Perfetto UI or
+     *               chrome://tracing. Each thread records into its own buffer, which
+     *               is released when the thread exits and its events are written.
+     */
+    class EZMQTracer
+    {
+        public:
+            /**
+             * Get instance of EZMQTracer.
+             *
+             * @return Instance of EZMQTracer.
+             */
+            static EZMQTracer &getInstance();
+
+            /**
+             * Start recording. Events of a previous recording are discarded.
+             *
+             * @param path - Trace file written on stop.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode start(const std::string &path);
+
+            /**
+             * Stop recording and write trace file.
+             *
+             * @return EZMQErrorCode - EZMQ_OK on success, otherwise appropriate error code.
+             */
+            EZMQErrorCode stop();
+
+            /**
+             * Check if recording.
+             *
+             * @return True if recording.
+             */
+            bool isRecording() const;
+
+            /**
+             * Record a completed stage of calling thread.
+             *
+             * @param name  - Stage name, a string literal.
+             * @param start - Start time, see now().
+             * @param end   - End time, see now().
+             */
+            void record(const char *name, uint64_t start, uint64_t end);
+
+            /**
+             * Get number of events dropped because a thread buffer was full.
+             *
+             * @return Number of dropped events.
+             */
+            uint64_t getDroppedCount() const;
+
+            /**
+             * Get monotonic time for trace events.
+             *
+             * @return Time in nanoseconds.
+             */
+            static uint64_t now();
+
+        private:
+            struct Event
+            {
+                const char *name;
+                uint64_t start;
+                uint64_t end;
+            };
+
+            struct ThreadBuffer
+            {
+                std::mutex lock;
+                std::vector<Event> events;
+                uint32_t threadId;
+                // Owner thread has exited, guarded by mTracerLock
+                bool closed;
+                ThreadBuffer() : threadId(0), closed(false) {}
+            };
+
+            // Releases buffer of a thread when the thread exits
+            struct BufferHolder
+            {
+                std::shared_ptr<ThreadBuffer> buffer;
+                ~BufferHolder();
+            };
+
+            EZMQTracer();
+            EZMQTracer(const EZMQTracer&) = delete;
+            EZMQTracer& operator=(const EZMQTracer&) = delete;
+
+            ThreadBuffer *getBuffer();
+            void release(const std::shared_ptr<ThreadBuffer> &buffer);
+            void removeClosedBuffers();
+
+            std::atomic<bool> mRecording;
+            std::atomic<uint64_t> mDroppedCount;
+            uint64_t mStartTime;
+            uint32_t mNextThreadId;
+            std::string mPath;
+            std::mutex mTracerLock;
+            std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;
+    };
+
+    /**
+     * @class  EZMQTraceScope
+     * @brief   Records a stage from construction until end() or destruction,
+     *               if the tracer is recording.
+     */
+    class EZMQTraceScope
+    {
+        public:
+            /**
+             * Construtor for EZMQTraceScope.
+             *
+             * @param name - Stage name, a string literal.
+             */
+            explicit EZMQTraceScope(const char *name);
+
+            /**
+             * Destructor for EZMQTraceScope.
+             */
+            ~EZMQTraceScope();
+
+            /**
+             * End the stage before end of scope.
+             */
+            void end();
+
+        private:
+            const char *mName;
+            uint64_t mStart;
+    };
+}
+#endif //EZMQ_TRACER_H_
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQAsyncLogger.h
+ *
+ * @brief This file contains asynchronous backend of EZMQ logger.
+ */
+
+#ifndef EZMQ_ASYNC_LOGGER_H_
+#define EZMQ_ASYNC_LOGGER_H_
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Max number of arguments kept in a log record
+#define EZMQ_LOG_RECORD_MAX_ARGS (8)
+
+// Storage for string arguments of a log record
+#define EZMQ_LOG_RECORD_STRING_SIZE (192)
+
+// Number of log records in ring of a thread
+#define EZMQ_LOG_RING_SIZE (512)
+
+/**
+* Get time of a log entry.
+*
+* @return Milliseconds since the epoch.
+*/
+uint64_t EZMQLogTime();
+
+/**
+* Write a formatted log entry to the log sink.
+*
+* @param level     - DEBUG, INFO, WARNING, ERROR, FATAL
+* @param tag       - Module name
+* @param timestamp - Milliseconds since the epoch.
+* @param logStr    - log string
+*/
+void EZMQLogWrite(int level, const char *tag, uint64_t timestamp, const char *logStr);
+
+namespace ezmq
+{
+    /**
+     * @struct  EZMQLogArg
+     * @brief   Binary copy of a printf argument.
+     */
+    struct EZMQLogArg
+    {
+        char type;
+        union
+        {
+            int64_t i;
+            uint64_t u;
+            double d;
+            const void *p;
+            uint16_t offset;
+        } value;
+    };
+
+    /**
+     * @struct  EZMQLogRecord
+     * @brief   Log entry as written by a producer thread. Format and tag are
+     *               string literals and kept as pointers, string arguments are copied.
+     */
+    struct EZMQLogRecord
+    {
+        int level;
+        const char *tag;
+        const char *format;
+        uint64_t timestamp;
+        uint8_t argCount;
+        uint16_t stringSize;
+        EZMQLogArg args[EZMQ_LOG_RECORD_MAX_ARGS];
+        char strings[EZMQ_LOG_RECORD_STRING_SIZE];
+    };
+
+    /**
+     * @class  EZMQAsyncLogger
+     * @brief   This class moves formatting and output of logs to a background thread.
+     *               Each producer thread owns a lock-free single producer ring of binary
+     *               records. When a ring is full the record is dropped and counted,
+     *               logging never blocks the caller.
+     */
+    class EZMQAsyncLogger
+    {
+        public:
+            /**
+             * Get instance of EZMQAsyncLogger.
+             *
+             * @return Instance of EZMQAsyncLogger.
+             */
+            static EZMQAsyncLogger &getInstance();
+
+            /**
+             * Start the background thread.
+             */
+            void start();
+
+            /**
+             * Stop the background thread, pending records are written. A record
+             * queued while stopping is written by the thread that queued it.
+             * It can be called from a log sink, also on the background thread.
+             */
+            void stop();
+
+            /**
+             * Check if the background thread is running.
+             *
+             * @return True if running.
+             */
+            bool isRunning() const;
+
+            /**
+             * Get time of a log entry. While running this is the time cached
+             * by the background thread on each pass, up to a pass old.
+             *
+             * @return Milliseconds since the epoch.
+             */
+            uint64_t getTime() const;
+
+            /**
+             * Queue a log entry with variable arguments.
+             *
+             * @param level  - Log level.
+             * @param tag    - Module name, a string literal.
+             * @param format - printf format, a string literal.
+             * @param args   - Arguments of format.
+             *
+             * @return True if handled, false if not running. A record dropped
+             *              because the ring is full is counted and handled.
+             */
+            bool logv(int level, const char *tag, const char *format, va_list args);
+
+            /**
+             * Queue a log string.
+             *
+             * @param level  - Log level.
+             * @param tag    - Module name, a string literal.
+             * @param logStr - Log string, it is copied.
+             *
+             * @return True if handled, false if not running. A record dropped
+             *              because the ring is full is counted and handled.
+             */
+            bool log(int level, const char *tag, const char *logStr);
+
+            /**
+             * Write all queued records from calling thread.
+             */
+            void flush();
+
+            /**
+             * Get number of records dropped because a ring was full.
+             *
+             * @return Number of dropped records.
+             */
+            uint64_t getDroppedCount() const;
+
+            /**
+             * Copy format arguments into a record.
+             *
+             * @param record - Record with format set.
+             * @param args   - Arguments of format.
+             *
+             * @return True if all arguments are copied, false if format has a
+             *              conversion that can not be deferred.
+             */
+            static bool capture(EZMQLogRecord &record, va_list args);
+
+            /**
+             * Format a record.
+             *
+             * @param record - Record to format.
+             * @param buffer - Output buffer.
+             * @param size   - Size of buffer.
+             */
+            static void render(const EZMQLogRecord &record, char *buffer, size_t size);
+
+        private:
+            struct Ring
+            {
+                EZMQLogRecord records[EZMQ_LOG_RING_SIZE];
+                std::atomic<size_t> head;
+                std::atomic<size_t> tail;
+                std::atomic<bool> closed;
+                Ring() : head(0), tail(0), closed(false) {}
+            };
+
+            struct RingHolder
+            {
+                std::shared_ptr<Ring> ring;
+                ~RingHolder();
+            };
+
+            EZMQAsyncLogger();
+            ~EZMQAsyncLogger();
+            EZMQAsyncLogger(const EZMQAsyncLogger&) = delete;
+            EZMQAsyncLogger& operator=(const EZMQAsyncLogger&) = delete;
+
+            Ring *getRing();
+            EZMQLogRecord *beginRecord(int level, const char *tag, Ring *&ring);
+            void commit(Ring *ring);
+            void drain();
+            void run(uint64_t generation);
+
+            std::atomic<bool> mRunning;
+            std::atomic<uint64_t> mDroppedCount;
+            std::atomic<uint64_t> mTime;
+            // Incremented by start(), a thread of an older generation exits
+            std::atomic<uint64_t> mGeneration;
+            uint64_t mReportedDrops;
+            std::thread mThread;
+            std::mutex mThreadLock;
+            std::mutex mWaitLock;
+            std::condition_variable mWaitCond;
+            std::mutex mDrainLock;
+            std::mutex mRingsLock;
+            std::vector<std::shared_ptr<Ring>> mRings;
+    };
+}
+#endif //EZMQ_ASYNC_LOGGER_H_
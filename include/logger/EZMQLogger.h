@@ -22,6 +22,7 @@
 #include <stdarg.h>
 #ifdef __cplusplus
 #include <cinttypes>
+#include <atomic>
 #else
 #include <inttypes.h>
 #endif
@@ -54,6 +55,9 @@ if (!PARAM) \
 // Max buffer size
 #define MAX_LOG_V_BUFFER_SIZE (256)
 
+// Default max entries per second of a log call site
+#define EZMQ_DEFAULT_LOG_RATE_LIMIT (100)
+
 // Setting this flag for a log level means that the corresponding log message
 // contains private data. This kind of message is logged only when a call to
 // EZMQSetLogLevel() enabled private data logging.
@@ -83,8 +87,21 @@ typedef enum {
 #define EZMQ_MINIMUM_LOG_LEVEL    (EZMQ_LOG_LEVEL)
 #endif
 
+#if defined(__GNUC__)
+#define EZMQ_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define EZMQ_UNLIKELY(x) (x)
+#endif
+
+// Runtime log level, see EZMQSetLogLevel(). It is read inline by the log macros
+// so a disabled level costs one branch and never reaches formatting.
+extern int g_ezmqLogLevel;
+
+// The first condition is a compile time constant, levels below EZMQ_LOG_LEVEL are
+// removed by the compiler. The second one is the runtime level check.
 #define IF_EZMQ_PRINT_LOG_LEVEL(level) \
-    if (((int)EZMQ_MINIMUM_LOG_LEVEL) <= ((int)(level & (~EZMQ_LOG_PRIVATE_DATA))))
+    if (((int)EZMQ_MINIMUM_LOG_LEVEL) <= ((int)((level) & (~EZMQ_LOG_PRIVATE_DATA))) && \
+        EZMQ_UNLIKELY(((int)((level) & (~EZMQ_LOG_PRIVATE_DATA))) >= g_ezmqLogLevel))
 
 /**
  * Set log level and privacy log to print.
@@ -94,6 +111,53 @@ typedef enum {
  */
 void EZMQSetLogLevel(LogLevel level, bool hidePrivateLogEntries);
 
+/**
+ * Callback to receive log entries instead of stdout.
+ *
+ * @param level     - DEBUG, INFO, WARNING, ERROR, FATAL
+ * @param tag       - Module name
+ * @param timestamp - Milliseconds since the epoch.
+ * @param logStr    - Formatted log string, valid only during the call.
+ * @param userData  - User data given to EZMQSetLogSink().
+ */
+typedef void (*EZMQLogSink)(int level, const char *tag, uint64_t timestamp,
+                            const char *logStr, void *userData);
+
+/**
+ * Set sink of log entries. With asynchronous logging calls to the sink are
+ * serialized, otherwise they are made from the logging threads and may overlap.
+ * The sink is called without internal locks held, so it can log or set the sink.
+ * A sink replaced while a call is in progress may still get that call.
+ *
+ * @param sink     - Log sink, NULL to print on stdout.
+ * @param userData - User data passed to sink.
+ */
+void EZMQSetLogSink(EZMQLogSink sink, void *userData);
+
+/**
+ * Set max number of entries per second logged by a single log statement.
+ * Excess entries are dropped before formatting and reported by the next
+ * entry of the statement. Default is EZMQ_DEFAULT_LOG_RATE_LIMIT.
+ *
+ * @param entriesPerSecond - Max entries per second, 0 for no limit.
+ */
+void EZMQSetLogRateLimit(uint32_t entriesPerSecond);
+
+/**
+ * Enable or disable asynchronous logging. When enabled, logging threads only
+ * queue binary records and a background thread formats and writes them.
+ * Records are dropped and counted if a thread logs faster than they are written.
+ * Disabling writes all pending records.
+ *
+ * @param enable - True to enable.
+ */
+void EZMQSetAsyncLogging(bool enable);
+
+/**
+ * Write all pending records of asynchronous logging.
+ */
+void EZMQFlushLog();
+
 /**
 * Output a variable argument list log string with the specified priority level.
 *
@@ -129,50 +193,103 @@ void EZMQLogBuffer(int level, const char* tag, const uint8_t* buffer, size_t buf
 
 #ifdef DEBUG_LOG
 
-#define EZMQ_LOG_BUFFER(level, tag, buffer, bufferSize) \
+// Log statement with its own rate limiter
+#define EZMQ_LOG_LIMITED(level, tag, call) \
     do { \
         IF_EZMQ_PRINT_LOG_LEVEL((level)) \
-            EZMQLogBuffer((level), (tag), (buffer), (bufferSize)); \
+        { \
+            static ezmq::EZMQLogRateLimiter ezmqLogLimiter; \
+            uint32_t ezmqLogSuppressed = 0; \
+            if (ezmqLogLimiter.allow(ezmqLogSuppressed)) \
+            { \
+                if (ezmqLogSuppressed) \
+                    EZMQLogv((level), (tag), "%u similar entries suppressed", ezmqLogSuppressed); \
+                call; \
+            } \
+        } \
     } while(0)
 
+#define EZMQ_LOG_BUFFER(level, tag, buffer, bufferSize) \
+    EZMQ_LOG_LIMITED(level, tag, EZMQLogBuffer((level), (tag), (buffer), (bufferSize)))
 
 #define EZMQ_LOG(level, tag, logStr) \
-    do { \
-        IF_EZMQ_PRINT_LOG_LEVEL((level)) \
-            EZMQLog((level), (tag), (logStr)); \
-    } while(0)
+    EZMQ_LOG_LIMITED(level, tag, EZMQLog((level), (tag), (logStr)))
 
 // Define variable argument log function
 #define EZMQ_LOG_V(level, tag, ...) \
-    do { \
-        IF_EZMQ_PRINT_LOG_LEVEL((level)) \
-            EZMQLogv((level), (tag), __VA_ARGS__); \
-    } while(0)
-
-#define EZMQ_SCOPE_LOGGER(TAG, FUNC) ScopeLogger scopeLogger(TAG, FUNC)
+    EZMQ_LOG_LIMITED(level, tag, EZMQLogv((level), (tag), __VA_ARGS__))
 
 #else // DEBUG_LOG
 #define EZMQ_LOG(level, tag, logStr)
 #define EZMQ_LOG_V(level, tag, ...)
 #define EZMQ_LOG_BUFFER(level, tag, buffer, bufferSize)
-#define EZMQ_SCOPE_LOGGER(TAG, FUNC)
 #endif // DEBUG_LOG
 
+// Scope logging [IN/OUT of a function] is opt-in per module. A module enables it
+// by defining EZMQ_SCOPE_LOG_MODULE to 1 before including any header, see the
+// SCOPE_LOG build option.
+#if defined(DEBUG_LOG) && defined(EZMQ_SCOPE_LOG_MODULE) && EZMQ_SCOPE_LOG_MODULE
+#define EZMQ_SCOPE_LOGGER(TAG, FUNC) ezmq::ScopeLogger scopeLogger(TAG, FUNC)
+#else
+#define EZMQ_SCOPE_LOGGER(TAG, FUNC)
+#endif
+
+// Logs on the per message send/receive paths. These are compiled only when
+// EZMQ_HOT_PATH_LOG is defined, see the HOT_PATH_LOG build option.
+#if defined(DEBUG_LOG) && defined(EZMQ_HOT_PATH_LOG)
+#define EZMQ_HOT_LOG(level, tag, logStr) EZMQ_LOG(level, tag, logStr)
+#define EZMQ_HOT_LOG_V(level, tag, ...) EZMQ_LOG_V(level, tag, __VA_ARGS__)
+#else
+#define EZMQ_HOT_LOG(level, tag, logStr)
+#define EZMQ_HOT_LOG_V(level, tag, ...)
+#endif
+
  namespace ezmq
 {
+    /**
+     * @class  EZMQLogRateLimiter
+     * @brief   Limits entries per second of a log statement, see EZMQSetLogRateLimit().
+     */
+    class EZMQLogRateLimiter
+    {
+        public:
+            constexpr EZMQLogRateLimiter() : mWindow(0), mCount(0), mSuppressed(0) {}
+
+            /**
+             * Check if an entry can be logged.
+             *
+             * @param suppressed - Number of entries dropped since the last allowed one.
+             *
+             * @return True if the entry can be logged.
+             */
+            bool allow(uint32_t &suppressed);
+
+        private:
+            std::atomic<int64_t> mWindow;
+            std::atomic<uint32_t> mCount;
+            std::atomic<uint32_t> mSuppressed;
+    };
+
     class ScopeLogger
     {
         public:
+            // Scope logs are not rate limited, all of them share this code
             ScopeLogger(const char *tag, const char *method)
             {
                 m_funName = method;
                 m_tag = tag;
-                EZMQ_LOG_V(DEBUG, m_tag, "[%s] IN", m_funName);
+#ifdef DEBUG_LOG
+                IF_EZMQ_PRINT_LOG_LEVEL(DEBUG)
+                    EZMQLogv(DEBUG, m_tag, "[%s] IN", m_funName);
+#endif
             }
 
             ~ScopeLogger()
             {
-                EZMQ_LOG_V(DEBUG, m_tag, "[%s] OUT", m_funName);
+#ifdef DEBUG_LOG
+                IF_EZMQ_PRINT_LOG_LEVEL(DEBUG)
+                    EZMQLogv(DEBUG, m_tag, "[%s] OUT", m_funName);
+#endif
             }
 
         private:
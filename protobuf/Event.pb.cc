@@ -103,6 +103,11 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, name_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, value_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, device_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, double_value_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, int_value_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, binary_value_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, double_values_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Reading, int_values_),
   0,
   4,
   5,
@@ -111,10 +116,15 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   1,
   2,
   3,
+  9,
+  10,
+  8,
+  ~0u,
+  ~0u,
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 12, sizeof(Event)},
-  { 19, 32, sizeof(Reading)},
+  { 19, 37, sizeof(Reading)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -165,15 +175,18 @@ void AddDescriptorsImpl() {
       "\n\013Event.proto\022\004ezmq\"\206\001\n\005Event\022\n\n\002id\030\001 \002("
       "\t\022\017\n\007created\030\002 \002(\003\022\020\n\010modified\030\003 \002(\003\022\016\n\006"
       "origin\030\004 \002(\003\022\016\n\006pushed\030\005 \002(\003\022\016\n\006device\030\006"
-      " \002(\t\022\036\n\007reading\030\007 \003(\0132\r.ezmq.Reading\"\205\001\n"
+      " \002(\t\022\036\n\007reading\030\007 \003(\0132\r.ezmq.Reading\"\367\001\n"
       "\007Reading\022\n\n\002id\030\001 \002(\t\022\017\n\007created\030\002 \002(\003\022\020\n"
       "\010modified\030\003 \002(\003\022\016\n\006origin\030\004 \002(\003\022\016\n\006pushe"
       "d\030\005 \002(\003\022\014\n\004name\030\006 \002(\t\022\r\n\005value\030\007 \002(\t\022\016\n\006"
-      "device\030\010 \002(\tB5\n#org.edgexfoundry.ezmq.pr"
-      "otobufeventB\016EZMQProtoEvent"
+      "device\030\010 \002(\t\022\024\n\014double_value\030\t \001(\001\022\021\n\tin"
+      "t_value\030\n \001(\022\022\024\n\014binary_value\030\013 \001(\014\022\031\n\rd"
+      "ouble_values\030\014 \003(\001B\002\020\001\022\026\n\nint_values\030\r \003"
+      "(\022B\002\020\001B5\n#org.edgexfoundry.ezmq.protobuf"
+      "eventB\016EZMQProtoEvent"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 347);
+      descriptor, 461);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "Event.proto", &protobuf_RegisterTypes);
 }
@@ -217,7 +230,8 @@ Event::Event()
   mContentType = EZMQ_CONTENT_TYPE_PROTOBUF;
 }
 Event::Event(const Event& from)
-  : ::google::protobuf::Message(),
+  : EZMQMessage(from),
+      ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _has_bits_(from._has_bits_),
       _cached_size_(0),
@@ -1032,6 +1046,11 @@ const int Reading::kPushedFieldNumber;
 const int Reading::kNameFieldNumber;
 const int Reading::kValueFieldNumber;
 const int Reading::kDeviceFieldNumber;
+const int Reading::kDoubleValueFieldNumber;
+const int Reading::kIntValueFieldNumber;
+const int Reading::kBinaryValueFieldNumber;
+const int Reading::kDoubleValuesFieldNumber;
+const int Reading::kIntValuesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Reading::Reading()
@@ -1046,7 +1065,9 @@ Reading::Reading(const Reading& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _has_bits_(from._has_bits_),
-      _cached_size_(0) {
+      _cached_size_(0),
+      double_values_(from.double_values_),
+      int_values_(from.int_values_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.has_id()) {
@@ -1064,9 +1085,13 @@ Reading::Reading(const Reading& from)
   if (from.has_device()) {
     device_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.device_);
   }
+  binary_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_binary_value()) {
+    binary_value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.binary_value_);
+  }
   ::memcpy(&created_, &from.created_,
-    static_cast<size_t>(reinterpret_cast<char*>(&pushed_) -
-    reinterpret_cast<char*>(&created_)) + sizeof(pushed_));
+    static_cast<size_t>(reinterpret_cast<char*>(&int_value_) -
+    reinterpret_cast<char*>(&created_)) + sizeof(int_value_));
   // @@protoc_insertion_point(copy_constructor:ezmq.Reading)
 }
 
@@ -1076,9 +1101,10 @@ void Reading::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   device_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  binary_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&created_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&pushed_) -
-      reinterpret_cast<char*>(&created_)) + sizeof(pushed_));
+      reinterpret_cast<char*>(&int_value_) -
+      reinterpret_cast<char*>(&created_)) + sizeof(int_value_));
 }
 
 Reading::~Reading() {
@@ -1091,6 +1117,7 @@ void Reading::SharedDtor() {
   name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   device_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  binary_value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
 void Reading::SetCachedSize(int size) const {
@@ -1122,6 +1149,8 @@ void Reading::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  double_values_.Clear();
+  int_values_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 15u) {
     if (cached_has_bits & 0x00000001u) {
@@ -1146,6 +1175,15 @@ void Reading::Clear() {
         reinterpret_cast<char*>(&pushed_) -
         reinterpret_cast<char*>(&created_)) + sizeof(pushed_));
   }
+  if (cached_has_bits & 0x00000100u) {
+    GOOGLE_DCHECK(!binary_value_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+    (*binary_value_.UnsafeRawStringPointer())->clear();
+  }
+  if (cached_has_bits & 1536u) {
+    ::memset(&double_value_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&int_value_) -
+        reinterpret_cast<char*>(&double_value_)) + sizeof(int_value_));
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear();
 }
@@ -1280,6 +1318,84 @@ bool Reading::MergePartialFromCodedStream(
         break;
       }
 
+      // optional double double_value = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(73u /* 73 & 0xFF */)) {
+          set_has_double_value();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &double_value_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional sint64 int_value = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+          set_has_int_value();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 input, &int_value_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes binary_value = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u /* 90 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_binary_value()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated double double_values = 12 [packed = true];
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(98u /* 98 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, this->mutable_double_values())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(97u /* 97 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 1, 98u, input, this->mutable_double_values())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint64 int_values = 13 [packed = true];
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(106u /* 106 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 input, this->mutable_int_values())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 1, 106u, input, this->mutable_int_values())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -1367,6 +1483,42 @@ void Reading::SerializeWithCachedSizes(
       8, this->device(), output);
   }
 
+  // optional double double_value = 9;
+  if (cached_has_bits & 0x00000200u) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(9, this->double_value(), output);
+  }
+
+  // optional sint64 int_value = 10;
+  if (cached_has_bits & 0x00000400u) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(10, this->int_value(), output);
+  }
+
+  // optional bytes binary_value = 11;
+  if (cached_has_bits & 0x00000100u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      11, this->binary_value(), output);
+  }
+
+  // repeated double double_values = 12 [packed = true];
+  if (this->double_values_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(12, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _double_values_cached_byte_size_));
+    ::google::protobuf::internal::WireFormatLite::WriteDoubleArray(
+      this->double_values().data(), this->double_values_size(), output);
+  }
+
+  // repeated sint64 int_values = 13 [packed = true];
+  if (this->int_values_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(13, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _int_values_cached_byte_size_));
+  }
+  for (int i = 0, n = this->int_values_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64NoTag(
+      this->int_values(i), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -1446,6 +1598,49 @@ void Reading::SerializeWithCachedSizes(
         8, this->device(), target);
   }
 
+  // optional double double_value = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(9, this->double_value(), target);
+  }
+
+  // optional sint64 int_value = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt64ToArray(10, this->int_value(), target);
+  }
+
+  // optional bytes binary_value = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        11, this->binary_value(), target);
+  }
+
+  // repeated double double_values = 12 [packed = true];
+  if (this->double_values_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      12,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _double_values_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteDoubleNoTagToArray(this->double_values_, target);
+  }
+
+  // repeated sint64 int_values = 13 [packed = true];
+  if (this->int_values_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      13,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::int32>(
+            _int_values_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt64NoTagToArray(this->int_values_, target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -1569,6 +1764,59 @@ size_t Reading::ByteSizeLong() const {
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
+  // repeated double double_values = 12 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->double_values_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _double_values_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated sint64 int_values = 13 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      SInt64Size(this->int_values_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _int_values_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  if (_has_bits_[8 / 32] & 1792u) {
+    // optional bytes binary_value = 11;
+    if (has_binary_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->binary_value());
+    }
+
+    // optional double double_value = 9;
+    if (has_double_value()) {
+      total_size += 1 + 8;
+    }
+
+    // optional sint64 int_value = 10;
+    if (has_int_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->int_value());
+    }
+
+  }
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -1598,6 +1846,8 @@ void Reading::MergeFrom(const Reading& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  double_values_.MergeFrom(from.double_values_);
+  int_values_.MergeFrom(from.int_values_);
   cached_has_bits = from._has_bits_[0];
   if (cached_has_bits & 255u) {
     if (cached_has_bits & 0x00000001u) {
@@ -1630,6 +1880,19 @@ void Reading::MergeFrom(const Reading& from) {
     }
     _has_bits_[0] |= cached_has_bits;
   }
+  if (cached_has_bits & 1792u) {
+    if (cached_has_bits & 0x00000100u) {
+      set_has_binary_value();
+      binary_value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.binary_value_);
+    }
+    if (cached_has_bits & 0x00000200u) {
+      double_value_ = from.double_value_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      int_value_ = from.int_value_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
 }
 
 void Reading::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1657,14 +1920,19 @@ void Reading::Swap(Reading* other) {
 }
 void Reading::InternalSwap(Reading* other) {
   using std::swap;
+  double_values_.InternalSwap(&other->double_values_);
+  int_values_.InternalSwap(&other->int_values_);
   id_.Swap(&other->id_);
   name_.Swap(&other->name_);
   value_.Swap(&other->value_);
   device_.Swap(&other->device_);
+  binary_value_.Swap(&other->binary_value_);
   swap(created_, other->created_);
   swap(modified_, other->modified_);
   swap(origin_, other->origin_);
   swap(pushed_, other->pushed_);
+  swap(double_value_, other->double_value_);
+  swap(int_value_, other->int_value_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
@@ -2026,6 +2294,177 @@ void Reading::set_allocated_device(::std::string* device) {
   // @@protoc_insertion_point(field_set_allocated:ezmq.Reading.device)
 }
 
+// optional double double_value = 9;
+bool Reading::has_double_value() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+void Reading::set_has_double_value() {
+  _has_bits_[0] |= 0x00000200u;
+}
+void Reading::clear_has_double_value() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+void Reading::clear_double_value() {
+  double_value_ = 0;
+  clear_has_double_value();
+}
+double Reading::double_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.double_value)
+  return double_value_;
+}
+void Reading::set_double_value(double value) {
+  set_has_double_value();
+  double_value_ = value;
+  // @@protoc_insertion_point(field_set:ezmq.Reading.double_value)
+}
+
+// optional sint64 int_value = 10;
+bool Reading::has_int_value() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+void Reading::set_has_int_value() {
+  _has_bits_[0] |= 0x00000400u;
+}
+void Reading::clear_has_int_value() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+void Reading::clear_int_value() {
+  int_value_ = GOOGLE_LONGLONG(0);
+  clear_has_int_value();
+}
+::google::protobuf::int64 Reading::int_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.int_value)
+  return int_value_;
+}
+void Reading::set_int_value(::google::protobuf::int64 value) {
+  set_has_int_value();
+  int_value_ = value;
+  // @@protoc_insertion_point(field_set:ezmq.Reading.int_value)
+}
+
+// optional bytes binary_value = 11;
+bool Reading::has_binary_value() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+void Reading::set_has_binary_value() {
+  _has_bits_[0] |= 0x00000100u;
+}
+void Reading::clear_has_binary_value() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+void Reading::clear_binary_value() {
+  binary_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_binary_value();
+}
+const ::std::string& Reading::binary_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.binary_value)
+  return binary_value_.GetNoArena();
+}
+void Reading::set_binary_value(const ::std::string& value) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.binary_value)
+}
+#if LANG_CXX11
+void Reading::set_binary_value(::std::string&& value) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:ezmq.Reading.binary_value)
+}
+#endif
+void Reading::set_binary_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:ezmq.Reading.binary_value)
+}
+void Reading::set_binary_value(const void* value, size_t size) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:ezmq.Reading.binary_value)
+}
+::std::string* Reading::mutable_binary_value() {
+  set_has_binary_value();
+  // @@protoc_insertion_point(field_mutable:ezmq.Reading.binary_value)
+  return binary_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* Reading::release_binary_value() {
+  // @@protoc_insertion_point(field_release:ezmq.Reading.binary_value)
+  clear_has_binary_value();
+  return binary_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void Reading::set_allocated_binary_value(::std::string* binary_value) {
+  if (binary_value != NULL) {
+    set_has_binary_value();
+  } else {
+    clear_has_binary_value();
+  }
+  binary_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binary_value);
+  // @@protoc_insertion_point(field_set_allocated:ezmq.Reading.binary_value)
+}
+
+// repeated double double_values = 12 [packed = true];
+int Reading::double_values_size() const {
+  return double_values_.size();
+}
+void Reading::clear_double_values() {
+  double_values_.Clear();
+}
+double Reading::double_values(int index) const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.double_values)
+  return double_values_.Get(index);
+}
+void Reading::set_double_values(int index, double value) {
+  double_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.double_values)
+}
+void Reading::add_double_values(double value) {
+  double_values_.Add(value);
+  // @@protoc_insertion_point(field_add:ezmq.Reading.double_values)
+}
+const ::google::protobuf::RepeatedField< double >&
+Reading::double_values() const {
+  // @@protoc_insertion_point(field_list:ezmq.Reading.double_values)
+  return double_values_;
+}
+::google::protobuf::RepeatedField< double >*
+Reading::mutable_double_values() {
+  // @@protoc_insertion_point(field_mutable_list:ezmq.Reading.double_values)
+  return &double_values_;
+}
+
+// repeated sint64 int_values = 13 [packed = true];
+int Reading::int_values_size() const {
+  return int_values_.size();
+}
+void Reading::clear_int_values() {
+  int_values_.Clear();
+}
+::google::protobuf::int64 Reading::int_values(int index) const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.int_values)
+  return int_values_.Get(index);
+}
+void Reading::set_int_values(int index, ::google::protobuf::int64 value) {
+  int_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.int_values)
+}
+void Reading::add_int_values(::google::protobuf::int64 value) {
+  int_values_.Add(value);
+  // @@protoc_insertion_point(field_add:ezmq.Reading.int_values)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+Reading::int_values() const {
+  // @@protoc_insertion_point(field_list:ezmq.Reading.int_values)
+  return int_values_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+Reading::mutable_int_values() {
+  // @@protoc_insertion_point(field_mutable_list:ezmq.Reading.int_values)
+  return &int_values_;
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
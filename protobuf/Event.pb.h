@@ -88,6 +88,7 @@ class Event : public EZMQMessage, public ::google::protobuf::Message {
 
   inline Event& operator=(const Event& from) {
     CopyFrom(from);
+    mSchemaId = from.mSchemaId;
     return *this;
   }
   #if LANG_CXX11
@@ -102,6 +103,7 @@ class Event : public EZMQMessage, public ::google::protobuf::Message {
     } else {
       CopyFrom(from);
     }
+    mSchemaId = from.mSchemaId;
     return *this;
   }
   #endif
@@ -357,6 +359,30 @@ class Reading : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 
   // accessors -------------------------------------------------------
 
+  // repeated double double_values = 12 [packed = true];
+  int double_values_size() const;
+  void clear_double_values();
+  static const int kDoubleValuesFieldNumber = 12;
+  double double_values(int index) const;
+  void set_double_values(int index, double value);
+  void add_double_values(double value);
+  const ::google::protobuf::RepeatedField< double >&
+      double_values() const;
+  ::google::protobuf::RepeatedField< double >*
+      mutable_double_values();
+
+  // repeated sint64 int_values = 13 [packed = true];
+  int int_values_size() const;
+  void clear_int_values();
+  static const int kIntValuesFieldNumber = 13;
+  ::google::protobuf::int64 int_values(int index) const;
+  void set_int_values(int index, ::google::protobuf::int64 value);
+  void add_int_values(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      int_values() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_int_values();
+
   // required string id = 1;
   bool has_id() const;
   void clear_id();
@@ -417,6 +443,21 @@ class Reading : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::std::string* release_device();
   void set_allocated_device(::std::string* device);
 
+  // optional bytes binary_value = 11;
+  bool has_binary_value() const;
+  void clear_binary_value();
+  static const int kBinaryValueFieldNumber = 11;
+  const ::std::string& binary_value() const;
+  void set_binary_value(const ::std::string& value);
+  #if LANG_CXX11
+  void set_binary_value(::std::string&& value);
+  #endif
+  void set_binary_value(const char* value);
+  void set_binary_value(const void* value, size_t size);
+  ::std::string* mutable_binary_value();
+  ::std::string* release_binary_value();
+  void set_allocated_binary_value(::std::string* binary_value);
+
   // required int64 created = 2;
   bool has_created() const;
   void clear_created();
@@ -445,6 +486,20 @@ class Reading : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::google::protobuf::int64 pushed() const;
   void set_pushed(::google::protobuf::int64 value);
 
+  // optional double double_value = 9;
+  bool has_double_value() const;
+  void clear_double_value();
+  static const int kDoubleValueFieldNumber = 9;
+  double double_value() const;
+  void set_double_value(double value);
+
+  // optional sint64 int_value = 10;
+  bool has_int_value() const;
+  void clear_int_value();
+  static const int kIntValueFieldNumber = 10;
+  ::google::protobuf::int64 int_value() const;
+  void set_int_value(::google::protobuf::int64 value);
+
   // @@protoc_insertion_point(class_scope:ezmq.Reading)
  private:
   void set_has_id();
@@ -463,6 +518,12 @@ class Reading : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   void clear_has_value();
   void set_has_device();
   void clear_has_device();
+  void set_has_double_value();
+  void clear_has_double_value();
+  void set_has_int_value();
+  void clear_has_int_value();
+  void set_has_binary_value();
+  void clear_has_binary_value();
 
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
@@ -470,14 +531,21 @@ class Reading : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::internal::HasBits<1> _has_bits_;
   mutable int _cached_size_;
+  ::google::protobuf::RepeatedField< double > double_values_;
+  mutable int _double_values_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > int_values_;
+  mutable int _int_values_cached_byte_size_;
   ::google::protobuf::internal::ArenaStringPtr id_;
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::internal::ArenaStringPtr value_;
   ::google::protobuf::internal::ArenaStringPtr device_;
+  ::google::protobuf::internal::ArenaStringPtr binary_value_;
   ::google::protobuf::int64 created_;
   ::google::protobuf::int64 modified_;
   ::google::protobuf::int64 origin_;
   ::google::protobuf::int64 pushed_;
+  double double_value_;
+  ::google::protobuf::int64 int_value_;
   friend struct protobuf_Event_2eproto::TableStruct;
 };
 // ===================================================================
@@ -1096,6 +1164,177 @@ inline void Reading::set_allocated_device(::std::string* device) {
   // @@protoc_insertion_point(field_set_allocated:ezmq.Reading.device)
 }
 
+// optional double double_value = 9;
+inline bool Reading::has_double_value() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void Reading::set_has_double_value() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void Reading::clear_has_double_value() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void Reading::clear_double_value() {
+  double_value_ = 0;
+  clear_has_double_value();
+}
+inline double Reading::double_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.double_value)
+  return double_value_;
+}
+inline void Reading::set_double_value(double value) {
+  set_has_double_value();
+  double_value_ = value;
+  // @@protoc_insertion_point(field_set:ezmq.Reading.double_value)
+}
+
+// optional sint64 int_value = 10;
+inline bool Reading::has_int_value() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void Reading::set_has_int_value() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void Reading::clear_has_int_value() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void Reading::clear_int_value() {
+  int_value_ = GOOGLE_LONGLONG(0);
+  clear_has_int_value();
+}
+inline ::google::protobuf::int64 Reading::int_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.int_value)
+  return int_value_;
+}
+inline void Reading::set_int_value(::google::protobuf::int64 value) {
+  set_has_int_value();
+  int_value_ = value;
+  // @@protoc_insertion_point(field_set:ezmq.Reading.int_value)
+}
+
+// optional bytes binary_value = 11;
+inline bool Reading::has_binary_value() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void Reading::set_has_binary_value() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void Reading::clear_has_binary_value() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void Reading::clear_binary_value() {
+  binary_value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_binary_value();
+}
+inline const ::std::string& Reading::binary_value() const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.binary_value)
+  return binary_value_.GetNoArena();
+}
+inline void Reading::set_binary_value(const ::std::string& value) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.binary_value)
+}
+#if LANG_CXX11
+inline void Reading::set_binary_value(::std::string&& value) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:ezmq.Reading.binary_value)
+}
+#endif
+inline void Reading::set_binary_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:ezmq.Reading.binary_value)
+}
+inline void Reading::set_binary_value(const void* value, size_t size) {
+  set_has_binary_value();
+  binary_value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:ezmq.Reading.binary_value)
+}
+inline ::std::string* Reading::mutable_binary_value() {
+  set_has_binary_value();
+  // @@protoc_insertion_point(field_mutable:ezmq.Reading.binary_value)
+  return binary_value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Reading::release_binary_value() {
+  // @@protoc_insertion_point(field_release:ezmq.Reading.binary_value)
+  clear_has_binary_value();
+  return binary_value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Reading::set_allocated_binary_value(::std::string* binary_value) {
+  if (binary_value != NULL) {
+    set_has_binary_value();
+  } else {
+    clear_has_binary_value();
+  }
+  binary_value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binary_value);
+  // @@protoc_insertion_point(field_set_allocated:ezmq.Reading.binary_value)
+}
+
+// repeated double double_values = 12 [packed = true];
+inline int Reading::double_values_size() const {
+  return double_values_.size();
+}
+inline void Reading::clear_double_values() {
+  double_values_.Clear();
+}
+inline double Reading::double_values(int index) const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.double_values)
+  return double_values_.Get(index);
+}
+inline void Reading::set_double_values(int index, double value) {
+  double_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.double_values)
+}
+inline void Reading::add_double_values(double value) {
+  double_values_.Add(value);
+  // @@protoc_insertion_point(field_add:ezmq.Reading.double_values)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+Reading::double_values() const {
+  // @@protoc_insertion_point(field_list:ezmq.Reading.double_values)
+  return double_values_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+Reading::mutable_double_values() {
+  // @@protoc_insertion_point(field_mutable_list:ezmq.Reading.double_values)
+  return &double_values_;
+}
+
+// repeated sint64 int_values = 13 [packed = true];
+inline int Reading::int_values_size() const {
+  return int_values_.size();
+}
+inline void Reading::clear_int_values() {
+  int_values_.Clear();
+}
+inline ::google::protobuf::int64 Reading::int_values(int index) const {
+  // @@protoc_insertion_point(field_get:ezmq.Reading.int_values)
+  return int_values_.Get(index);
+}
+inline void Reading::set_int_values(int index, ::google::protobuf::int64 value) {
+  int_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ezmq.Reading.int_values)
+}
+inline void Reading::add_int_values(::google::protobuf::int64 value) {
+  int_values_.Add(value);
+  // @@protoc_insertion_point(field_add:ezmq.Reading.int_values)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+Reading::int_values() const {
+  // @@protoc_insertion_point(field_list:ezmq.Reading.int_values)
+  return int_values_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+Reading::mutable_int_values() {
+  // @@protoc_insertion_point(field_mutable_list:ezmq.Reading.int_values)
+  return &int_values_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
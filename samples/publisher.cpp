@@ -74,6 +74,7 @@ ezmq::Event getProtoBufEvent()
     ezmq::Reading *reading1 = event.add_reading();
     reading1->set_name("reading1");
     reading1->set_value("10");
+    reading1->set_int_value(10);
     reading1->set_created(25);
     reading1->set_device("device");
     reading1->set_modified(20);
@@ -84,6 +85,7 @@ ezmq::Event getProtoBufEvent()
     ezmq::Reading *readin2  = event.add_reading();
     readin2->set_name("reading2");
     readin2->set_value("20");
+    readin2->set_double_value(20.5);
     readin2->set_created(30);
     readin2->set_device("device");
     readin2->set_modified(20);
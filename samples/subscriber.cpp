@@ -60,6 +60,14 @@ void printEvent(const ezmq::Event &event)
         Reading reading = event.reading(i);
         cout<<"Key: " + reading.name()<<endl;
         cout<<"Value: " + reading.value()<<endl;
+        if (reading.has_int_value())
+        {
+            cout<<"Int value: "<<reading.int_value()<<endl;
+        }
+        if (reading.has_double_value())
+        {
+            cout<<"Double value: "<<reading.double_value()<<endl;
+        }
         i++;
     }
     cout<<"----------------------------------------"<<endl;
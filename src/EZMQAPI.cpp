@@ -15,6 +15,10 @@
  *
  *******************************************************************************/
 
+#ifdef EZMQ_SCOPE_LOG_API
+#define EZMQ_SCOPE_LOG_MODULE 1
+#endif
+
 #include "EZMQAPI.h"
 #include "EZMQLogger.h"
 
@@ -0,0 +1,360 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQCompression.h"
+#include "EZMQLogger.h"
+
+#ifdef COMPRESSION_ENABLED
+#include "lz4.h"
+#include "lz4hc.h"
+#include "zstd.h"
+#include "zdict.h"
+#endif // COMPRESSION_ENABLED
+
+#define SIZE_PREFIX_LENGTH 4
+#define MAX_DECOMPRESSED_SIZE (64 * 1024 * 1024)
+// Max ratios the codecs can reach, a size prefix beyond them is not trusted.
+// LZ4 encodes 255 bytes of match length per byte at best, zstd RLE blocks of
+// 128KB take a few bytes.
+#define MAX_LZ4_COMPRESSION_RATIO 256
+#define MAX_ZSTD_COMPRESSION_RATIO (32 * 1024)
+#define TAG "EZMQCompression"
+
+namespace ezmq
+{
+#ifdef COMPRESSION_ENABLED
+    // zstd contexts are reused per thread to avoid allocation per message
+    struct ZstdContexts
+    {
+        ZstdContexts() : cctx(ZSTD_createCCtx()), dctx(ZSTD_createDCtx()) {}
+        ~ZstdContexts()
+        {
+            ZSTD_freeCCtx(cctx);
+            ZSTD_freeDCtx(dctx);
+        }
+        ZSTD_CCtx *cctx;
+        ZSTD_DCtx *dctx;
+    };
+
+    static ZstdContexts &getZstdContexts()
+    {
+        static thread_local ZstdContexts contexts;
+        return contexts;
+    }
+
+    // Reserve output for size prefix and compressed data, returns start of compressed data
+    static char *writeSizePrefix(size_t size, size_t bound, std::string &output)
+    {
+        output.resize(SIZE_PREFIX_LENGTH + bound);
+        output[0] = (char)((size >> 24) & 0xFF);
+        output[1] = (char)((size >> 16) & 0xFF);
+        output[2] = (char)((size >> 8) & 0xFF);
+        output[3] = (char)(size & 0xFF);
+        return &output[SIZE_PREFIX_LENGTH];
+    }
+
+    // Reserve output for original size, returns false for invalid payload.
+    // Size prefix comes from peer, it is checked before allocating output.
+    static bool readSizePrefix(bool isZstd, const void *data, size_t size, std::string &output)
+    {
+        if(size < SIZE_PREFIX_LENGTH)
+        {
+            EZMQ_LOG(ERROR, TAG, "Compressed payload is too short");
+            return false;
+        }
+        const unsigned char *src = (const unsigned char *)data;
+        size_t originalSize = ((size_t)src[0] << 24) | ((size_t)src[1] << 16) |
+            ((size_t)src[2] << 8) | (size_t)src[3];
+        size_t compressedSize = size - SIZE_PREFIX_LENGTH;
+        size_t maxRatio = isZstd ? MAX_ZSTD_COMPRESSION_RATIO : MAX_LZ4_COMPRESSION_RATIO;
+        if(originalSize > MAX_DECOMPRESSED_SIZE || originalSize > compressedSize * maxRatio)
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Invalid decompressed size: %zu", originalSize);
+            return false;
+        }
+        if(isZstd)
+        {
+            // zstd frame carries content size as well, both must agree
+            unsigned long long contentSize = ZSTD_getFrameContentSize(src + SIZE_PREFIX_LENGTH,
+                compressedSize);
+            if(ZSTD_CONTENTSIZE_ERROR == contentSize ||
+                (ZSTD_CONTENTSIZE_UNKNOWN != contentSize && contentSize != originalSize))
+            {
+                EZMQ_LOG(ERROR, TAG, "Invalid zstd frame");
+                return false;
+            }
+        }
+        output.resize(originalSize);
+        return true;
+    }
+
+    static bool isZstdError(size_t result)
+    {
+        if(ZSTD_isError(result))
+        {
+            EZMQ_LOG_V(ERROR, TAG, "zstd failed: %s", ZSTD_getErrorName(result));
+            return true;
+        }
+        return false;
+    }
+
+    static EZMQErrorCode checkCompressed(size_t result, std::string &output)
+    {
+        if(isZstdError(result))
+        {
+            return EZMQ_ERROR;
+        }
+        output.resize(SIZE_PREFIX_LENGTH + result);
+        return EZMQ_OK;
+    }
+
+    static EZMQErrorCode checkDecompressed(size_t result, const std::string &output)
+    {
+        if(isZstdError(result))
+        {
+            return EZMQ_ERROR;
+        }
+        if(result != output.size())
+        {
+            EZMQ_LOG(ERROR, TAG, "Decompressed size mismatch");
+            return EZMQ_ERROR;
+        }
+        return EZMQ_OK;
+    }
+#endif // COMPRESSION_ENABLED
+
+    EZMQCompressionDictionary::EZMQCompressionDictionary(const std::string &dictionary, int level):
+        mCompressionDict(NULL), mDecompressionDict(NULL), mId(0)
+    {
+#ifdef COMPRESSION_ENABLED
+        mId = ZSTD_getDictID_fromDict(dictionary.c_str(), dictionary.size());
+        if(0 == mId)
+        {
+            EZMQ_LOG(ERROR, TAG, "Not a trained dictionary");
+            return;
+        }
+        mCompressionDict = ZSTD_createCDict(dictionary.c_str(), dictionary.size(), level);
+        mDecompressionDict = ZSTD_createDDict(dictionary.c_str(), dictionary.size());
+        if(NULL == mCompressionDict || NULL == mDecompressionDict)
+        {
+            EZMQ_LOG(ERROR, TAG, "Dictionary creation failed");
+            mId = 0;
+        }
+#else
+        UNUSED(dictionary);
+        UNUSED(level);
+#endif // COMPRESSION_ENABLED
+    }
+
+    EZMQCompressionDictionary::~EZMQCompressionDictionary()
+    {
+#ifdef COMPRESSION_ENABLED
+        ZSTD_freeCDict((ZSTD_CDict *)mCompressionDict);
+        ZSTD_freeDDict((ZSTD_DDict *)mDecompressionDict);
+#endif // COMPRESSION_ENABLED
+    }
+
+    unsigned int EZMQCompressionDictionary::getId() const
+    {
+        return mId;
+    }
+
+    bool EZMQCompression::isSupported(EZMQCompressionCodec codec)
+    {
+        switch(codec)
+        {
+            case EZMQ_COMPRESSION_NONE:
+                return true;
+#ifdef COMPRESSION_ENABLED
+            case EZMQ_COMPRESSION_LZ4:
+            case EZMQ_COMPRESSION_ZSTD:
+            case EZMQ_COMPRESSION_ZSTD_DICT:
+                return true;
+#endif // COMPRESSION_ENABLED
+            default:
+                return false;
+        }
+    }
+
+    EZMQErrorCode EZMQCompression::compress(EZMQCompressionCodec codec, int level,
+        const void *data, size_t size, std::string &output)
+    {
+        // dictionary codec needs dictionary
+        if((EZMQ_COMPRESSION_LZ4 != codec && EZMQ_COMPRESSION_ZSTD != codec) || !isSupported(codec) ||
+            size > MAX_DECOMPRESSED_SIZE)
+        {
+            return EZMQ_ERROR;
+        }
+#ifdef COMPRESSION_ENABLED
+        if(EZMQ_COMPRESSION_LZ4 == codec)
+        {
+            int bound = LZ4_compressBound(size);
+            char *dst = writeSizePrefix(size, bound, output);
+            int result = (level > 0) ?
+                LZ4_compress_HC((const char *)data, dst, size, bound, level) :
+                LZ4_compress_default((const char *)data, dst, size, bound);
+            if(result <= 0)
+            {
+                EZMQ_LOG(ERROR, TAG, "LZ4 compression failed");
+                return EZMQ_ERROR;
+            }
+            output.resize(SIZE_PREFIX_LENGTH + result);
+            return EZMQ_OK;
+        }
+        size_t bound = ZSTD_compressBound(size);
+        char *dst = writeSizePrefix(size, bound, output);
+        size_t result = ZSTD_compressCCtx(getZstdContexts().cctx, dst, bound, data, size, level);
+        return checkCompressed(result, output);
+#else
+        UNUSED(level);
+        UNUSED(data);
+        UNUSED(output);
+        return EZMQ_ERROR;
+#endif // COMPRESSION_ENABLED
+    }
+
+    EZMQErrorCode EZMQCompression::decompress(EZMQCompressionCodec codec, const void *data,
+        size_t size, std::string &output)
+    {
+        if((EZMQ_COMPRESSION_LZ4 != codec && EZMQ_COMPRESSION_ZSTD != codec) || !isSupported(codec))
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Not a supported codec: %d", codec);
+            return EZMQ_ERROR;
+        }
+#ifdef COMPRESSION_ENABLED
+        if(!readSizePrefix(EZMQ_COMPRESSION_ZSTD == codec, data, size, output))
+        {
+            return EZMQ_ERROR;
+        }
+        const char *src = (const char *)data + SIZE_PREFIX_LENGTH;
+        size -= SIZE_PREFIX_LENGTH;
+        if(EZMQ_COMPRESSION_LZ4 == codec)
+        {
+            int result = LZ4_decompress_safe(src, &output[0], size, output.size());
+            if(result < 0 || (size_t)result != output.size())
+            {
+                EZMQ_LOG(ERROR, TAG, "LZ4 decompression failed");
+                return EZMQ_ERROR;
+            }
+            return EZMQ_OK;
+        }
+        size_t result = ZSTD_decompressDCtx(getZstdContexts().dctx, &output[0], output.size(),
+            src, size);
+        return checkDecompressed(result, output);
+#else
+        UNUSED(data);
+        UNUSED(size);
+        UNUSED(output);
+        return EZMQ_ERROR;
+#endif // COMPRESSION_ENABLED
+    }
+
+    EZMQErrorCode EZMQCompression::compress(const EZMQCompressionDictionary &dictionary,
+        const void *data, size_t size, std::string &output)
+    {
+        if(0 == dictionary.getId() || size > MAX_DECOMPRESSED_SIZE)
+        {
+            return EZMQ_ERROR;
+        }
+#ifdef COMPRESSION_ENABLED
+        size_t bound = ZSTD_compressBound(size);
+        char *dst = writeSizePrefix(size, bound, output);
+        size_t result = ZSTD_compress_usingCDict(getZstdContexts().cctx, dst, bound, data, size,
+            (const ZSTD_CDict *)dictionary.mCompressionDict);
+        return checkCompressed(result, output);
+#else
+        UNUSED(data);
+        UNUSED(output);
+        return EZMQ_ERROR;
+#endif // COMPRESSION_ENABLED
+    }
+
+    EZMQErrorCode EZMQCompression::decompress(const EZMQCompressionDictionary &dictionary,
+        const void *data, size_t size, std::string &output)
+    {
+        if(0 == dictionary.getId())
+        {
+            return EZMQ_ERROR;
+        }
+#ifdef COMPRESSION_ENABLED
+        if(!readSizePrefix(true, data, size, output))
+        {
+            return EZMQ_ERROR;
+        }
+        size_t result = ZSTD_decompress_usingDDict(getZstdContexts().dctx, &output[0], output.size(),
+            (const char *)data + SIZE_PREFIX_LENGTH, size - SIZE_PREFIX_LENGTH,
+            (const ZSTD_DDict *)dictionary.mDecompressionDict);
+        return checkDecompressed(result, output);
+#else
+        UNUSED(data);
+        UNUSED(size);
+        UNUSED(output);
+        return EZMQ_ERROR;
+#endif // COMPRESSION_ENABLED
+    }
+
+    unsigned int EZMQCompression::getDictionaryId(const void *data, size_t size)
+    {
+#ifdef COMPRESSION_ENABLED
+        if(size < SIZE_PREFIX_LENGTH)
+        {
+            return 0;
+        }
+        return ZSTD_getDictID_fromFrame((const char *)data + SIZE_PREFIX_LENGTH,
+            size - SIZE_PREFIX_LENGTH);
+#else
+        UNUSED(data);
+        UNUSED(size);
+        return 0;
+#endif // COMPRESSION_ENABLED
+    }
+
+    EZMQErrorCode EZMQCompression::trainDictionary(const std::vector<std::string> &samples,
+        size_t capacity, std::string &dictionary)
+    {
+#ifdef COMPRESSION_ENABLED
+        if(samples.empty() || !capacity)
+        {
+            return EZMQ_ERROR;
+        }
+        std::string buffer;
+        std::vector<size_t> sizes;
+        sizes.reserve(samples.size());
+        for (auto &sample : samples)
+        {
+            buffer += sample;
+            sizes.push_back(sample.size());
+        }
+        dictionary.resize(capacity);
+        size_t result = ZDICT_trainFromBuffer(&dictionary[0], capacity, buffer.c_str(), sizes.data(),
+            sizes.size());
+        if(ZDICT_isError(result))
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Dictionary training failed: %s", ZDICT_getErrorName(result));
+            dictionary.clear();
+            return EZMQ_ERROR;
+        }
+        dictionary.resize(result);
+        return EZMQ_OK;
+#else
+        UNUSED(samples);
+        UNUSED(capacity);
+        UNUSED(dictionary);
+        return EZMQ_ERROR;
+#endif // COMPRESSION_ENABLED
+    }
+}
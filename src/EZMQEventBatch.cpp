@@ -0,0 +1,516 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+#include "EZMQEventBatch.h"
+#include "Event.pb.h"
+#include "EZMQLogger.h"
+#include "EZMQTypedValue.h"
+
+// Version 2 adds typed value columns, batches without typed values stay in version 1
+#define FORMAT_VERSION 1
+#define TYPED_FORMAT_VERSION 2
+#define TAG "EZMQEventBatch"
+
+namespace ezmq
+{
+    typedef ::google::protobuf::int64 (Reading::*TimestampGetter)() const;
+    typedef void (Reading::*TimestampSetter)(::google::protobuf::int64);
+    typedef const std::string &(Reading::*StringGetter)() const;
+    typedef std::string *(Reading::*StringSetter)();
+
+    // Reading columns, in order of encoding
+    static const TimestampGetter TIMESTAMP_GETTERS[] = {&Reading::created, &Reading::modified,
+        &Reading::origin, &Reading::pushed};
+    static const TimestampSetter TIMESTAMP_SETTERS[] = {&Reading::set_created, &Reading::set_modified,
+        &Reading::set_origin, &Reading::set_pushed};
+    static const StringGetter STRING_GETTERS[] = {&Reading::id, &Reading::name, &Reading::value,
+        &Reading::device};
+    static const StringSetter STRING_SETTERS[] = {&Reading::mutable_id, &Reading::mutable_name,
+        &Reading::mutable_value, &Reading::mutable_device};
+    static const size_t TIMESTAMP_COLUMNS = sizeof(TIMESTAMP_GETTERS) / sizeof(TIMESTAMP_GETTERS[0]);
+    static const size_t STRING_COLUMNS = sizeof(STRING_GETTERS) / sizeof(STRING_GETTERS[0]);
+
+    // Typed value column has values of readings whose mask has its bit set
+    enum TypedValueMask
+    {
+        DOUBLE_VALUE = 0x01,
+        INT_VALUE = 0x02,
+        BINARY_VALUE = 0x04,
+        DOUBLE_VALUES = 0x08,
+        INT_VALUES = 0x10
+    };
+
+    static uint8_t getTypedValueMask(const Reading &reading)
+    {
+        return (reading.has_double_value() ? DOUBLE_VALUE : 0) |
+            (reading.has_int_value() ? INT_VALUE : 0) |
+            (reading.has_binary_value() ? BINARY_VALUE : 0) |
+            (reading.double_values_size() ? DOUBLE_VALUES : 0) |
+            (reading.int_values_size() ? INT_VALUES : 0);
+    }
+
+    static void writeVarint(std::string &out, uint64_t value)
+    {
+        while(value >= 0x80)
+        {
+            out += (char)(value | 0x80);
+            value >>= 7;
+        }
+        out += (char)value;
+    }
+
+    // Delta from previous value with wrap around, zigzag encoded for small negative deltas
+    static void writeDelta(std::string &out, int64_t value, int64_t previous)
+    {
+        int64_t delta = (int64_t)((uint64_t)value - (uint64_t)previous);
+        writeVarint(out, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+    }
+
+    static void writeString(std::string &out, const std::string &value)
+    {
+        writeVarint(out, value.size());
+        out += value;
+    }
+
+    // IEEE 754 bits in little endian
+    static void writeDouble(std::string &out, double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; i++)
+        {
+            out += (char)(bits >> (i * 8));
+        }
+    }
+
+    static void writeTypedColumns(std::string &out, const Event &event, const std::vector<uint8_t> &masks)
+    {
+        const int count = event.reading_size();
+        for (uint8_t mask : masks)
+        {
+            out += (char)mask;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            if(masks[i] & DOUBLE_VALUE)
+            {
+                writeDouble(out, event.reading(i).double_value());
+            }
+        }
+        int64_t previous = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if(masks[i] & INT_VALUE)
+            {
+                writeDelta(out, event.reading(i).int_value(), previous);
+                previous = event.reading(i).int_value();
+            }
+        }
+        for (int i = 0; i < count; i++)
+        {
+            if(masks[i] & BINARY_VALUE)
+            {
+                writeString(out, event.reading(i).binary_value());
+            }
+        }
+        for (int i = 0; i < count; i++)
+        {
+            const Reading &reading = event.reading(i);
+            if(masks[i] & DOUBLE_VALUES)
+            {
+                writeVarint(out, reading.double_values_size());
+                for (double value : reading.double_values())
+                {
+                    writeDouble(out, value);
+                }
+            }
+        }
+        previous = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const Reading &reading = event.reading(i);
+            if(masks[i] & INT_VALUES)
+            {
+                writeVarint(out, reading.int_values_size());
+                for (int64_t value : reading.int_values())
+                {
+                    writeDelta(out, value, previous);
+                    previous = value;
+                }
+            }
+        }
+    }
+
+    class BatchReader
+    {
+        public:
+            BatchReader(const std::string &data) :
+                mPos((const uint8_t *)data.data()), mEnd((const uint8_t *)data.data() + data.size()) {}
+
+            size_t remaining() const
+            {
+                return mEnd - mPos;
+            }
+
+            bool readByte(uint8_t &value)
+            {
+                if(mPos == mEnd)
+                {
+                    return false;
+                }
+                value = *mPos++;
+                return true;
+            }
+
+            bool readVarint(uint64_t &value)
+            {
+                value = 0;
+                for (int shift = 0; shift < 64 && mPos != mEnd; shift += 7)
+                {
+                    uint8_t byte = *mPos++;
+                    value |= (uint64_t)(byte & 0x7F) << shift;
+                    if(!(byte & 0x80))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool readDelta(int64_t &value, int64_t previous)
+            {
+                uint64_t encoded;
+                if(!readVarint(encoded))
+                {
+                    return false;
+                }
+                int64_t delta = (int64_t)((encoded >> 1) ^ (0 - (encoded & 1)));
+                value = (int64_t)((uint64_t)previous + (uint64_t)delta);
+                return true;
+            }
+
+            bool readString(std::string &value)
+            {
+                uint64_t size;
+                if(!readVarint(size) || size > remaining())
+                {
+                    return false;
+                }
+                value.assign((const char *)mPos, size);
+                mPos += size;
+                return true;
+            }
+
+            bool readDouble(double &value)
+            {
+                if(remaining() < 8)
+                {
+                    return false;
+                }
+                uint64_t bits = 0;
+                for (int i = 0; i < 8; i++)
+                {
+                    bits |= (uint64_t)(*mPos++) << (i * 8);
+                }
+                memcpy(&value, &bits, sizeof(value));
+                return true;
+            }
+
+            // Size of array which takes at least minSize bytes per element
+            bool readSize(uint64_t &size, size_t minSize)
+            {
+                return readVarint(size) && size && size <= remaining() / minSize;
+            }
+
+        private:
+            const uint8_t *mPos;
+            const uint8_t *mEnd;
+    };
+
+    static bool readTypedColumns(BatchReader &reader, Event &event)
+    {
+        auto readings = event.mutable_reading();
+        std::vector<uint8_t> masks(readings->size());
+        for (auto &mask : masks)
+        {
+            if(!reader.readByte(mask) || mask > (DOUBLE_VALUE | INT_VALUE | BINARY_VALUE |
+                DOUBLE_VALUES | INT_VALUES))
+            {
+                return false;
+            }
+        }
+        for (int i = 0; i < readings->size(); i++)
+        {
+            double value;
+            if(masks[i] & DOUBLE_VALUE)
+            {
+                if(!reader.readDouble(value))
+                {
+                    return false;
+                }
+                readings->Mutable(i)->set_double_value(value);
+            }
+        }
+        int64_t previous = 0;
+        for (int i = 0; i < readings->size(); i++)
+        {
+            if(masks[i] & INT_VALUE)
+            {
+                if(!reader.readDelta(previous, previous))
+                {
+                    return false;
+                }
+                readings->Mutable(i)->set_int_value(previous);
+            }
+        }
+        for (int i = 0; i < readings->size(); i++)
+        {
+            if((masks[i] & BINARY_VALUE) &&
+                !reader.readString(*(readings->Mutable(i)->mutable_binary_value())))
+            {
+                return false;
+            }
+        }
+        for (int i = 0; i < readings->size(); i++)
+        {
+            uint64_t size;
+            if(!(masks[i] & DOUBLE_VALUES))
+            {
+                continue;
+            }
+            if(!reader.readSize(size, 8))
+            {
+                return false;
+            }
+            auto values = readings->Mutable(i)->mutable_double_values();
+            values->Reserve(size);
+            for (uint64_t j = 0; j < size; j++)
+            {
+                double value;
+                if(!reader.readDouble(value))
+                {
+                    return false;
+                }
+                values->Add(value);
+            }
+        }
+        previous = 0;
+        for (int i = 0; i < readings->size(); i++)
+        {
+            uint64_t size;
+            if(!(masks[i] & INT_VALUES))
+            {
+                continue;
+            }
+            if(!reader.readSize(size, 1))
+            {
+                return false;
+            }
+            auto values = readings->Mutable(i)->mutable_int_values();
+            values->Reserve(size);
+            for (uint64_t j = 0; j < size; j++)
+            {
+                if(!reader.readDelta(previous, previous))
+                {
+                    return false;
+                }
+                values->Add(previous);
+            }
+        }
+        return true;
+    }
+
+    EZMQEventBatch::EZMQEventBatch()
+    {
+        mContentType = EZMQ_CONTENT_TYPE_EVENT_BATCH;
+    }
+
+    EZMQEventBatch::~EZMQEventBatch()
+    {
+    }
+
+    const std::string &EZMQEventBatch::getData() const
+    {
+        return mData;
+    }
+
+    void EZMQEventBatch::setData(const std::string &data)
+    {
+        mData = data;
+    }
+
+    EZMQErrorCode EZMQEventBatch::setEvent(const Event &event)
+    {
+        const int count = event.reading_size();
+        bool isTyped = false;
+        for (int i = 0; i < count && !isTyped; i++)
+        {
+            isTyped = hasTypedValue(event.reading(i));
+        }
+        const int64_t eventTimestamps[] = {event.created(), event.modified(), event.origin(),
+            event.pushed()};
+
+        // Dictionary of distinct strings of readings
+        std::unordered_map<std::string, uint64_t> indexes;
+        std::vector<const std::string *> dictionary;
+        std::vector<uint64_t> columns(STRING_COLUMNS * count);
+        for (size_t column = 0; column < STRING_COLUMNS; column++)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                const std::string &value = (event.reading(i).*STRING_GETTERS[column])();
+                auto result = indexes.insert(std::make_pair(value, (uint64_t)dictionary.size()));
+                if(result.second)
+                {
+                    dictionary.push_back(&(result.first->first));
+                }
+                columns[column * count + i] = result.first->second;
+            }
+        }
+
+        std::string data;
+        data += (char)(isTyped ? TYPED_FORMAT_VERSION : FORMAT_VERSION);
+        writeString(data, event.id());
+        for (size_t column = 0; column < TIMESTAMP_COLUMNS; column++)
+        {
+            writeDelta(data, eventTimestamps[column], 0);
+        }
+        writeString(data, event.device());
+        writeVarint(data, count);
+        writeVarint(data, dictionary.size());
+        for (auto value : dictionary)
+        {
+            writeString(data, *value);
+        }
+        for (size_t column = 0; column < TIMESTAMP_COLUMNS; column++)
+        {
+            int64_t previous = eventTimestamps[column];
+            for (int i = 0; i < count; i++)
+            {
+                int64_t value = (event.reading(i).*TIMESTAMP_GETTERS[column])();
+                writeDelta(data, value, previous);
+                previous = value;
+            }
+        }
+        for (uint64_t index : columns)
+        {
+            writeVarint(data, index);
+        }
+        if(isTyped)
+        {
+            std::vector<uint8_t> masks(count);
+            for (int i = 0; i < count; i++)
+            {
+                masks[i] = getTypedValueMask(event.reading(i));
+            }
+            writeTypedColumns(data, event, masks);
+        }
+        mData.swap(data);
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQEventBatch::getEvent(Event &event) const
+    {
+        event.Clear();
+        BatchReader reader(mData);
+        uint8_t version = 0;
+        int64_t eventTimestamps[TIMESTAMP_COLUMNS];
+        uint64_t count = 0;
+        uint64_t dictionarySize = 0;
+        bool result = reader.readByte(version) &&
+            (FORMAT_VERSION == version || TYPED_FORMAT_VERSION == version) &&
+            reader.readString(*event.mutable_id());
+        const size_t columnCount = TIMESTAMP_COLUMNS + STRING_COLUMNS +
+            (TYPED_FORMAT_VERSION == version ? 1 : 0);
+        for (size_t column = 0; result && column < TIMESTAMP_COLUMNS; column++)
+        {
+            result = reader.readDelta(eventTimestamps[column], 0);
+        }
+        // every reading and dictionary entry takes at least one byte per column
+        result = result && reader.readString(*event.mutable_device()) && reader.readVarint(count) &&
+            count <= reader.remaining() / columnCount &&
+            reader.readVarint(dictionarySize) && dictionarySize <= reader.remaining();
+        if(!result)
+        {
+            EZMQ_LOG(ERROR, TAG, "Malformed event header");
+            return EZMQ_ERROR;
+        }
+        event.set_created(eventTimestamps[0]);
+        event.set_modified(eventTimestamps[1]);
+        event.set_origin(eventTimestamps[2]);
+        event.set_pushed(eventTimestamps[3]);
+
+        std::vector<std::string> dictionary(dictionarySize);
+        for (auto &value : dictionary)
+        {
+            if(!reader.readString(value))
+            {
+                EZMQ_LOG(ERROR, TAG, "Malformed dictionary");
+                return EZMQ_ERROR;
+            }
+        }
+
+        auto readings = event.mutable_reading();
+        readings->Reserve(count);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            readings->Add();
+        }
+        for (size_t column = 0; column < TIMESTAMP_COLUMNS; column++)
+        {
+            int64_t value = eventTimestamps[column];
+            for (auto &reading : *readings)
+            {
+                if(!reader.readDelta(value, value))
+                {
+                    EZMQ_LOG(ERROR, TAG, "Malformed timestamp column");
+                    return EZMQ_ERROR;
+                }
+                (reading.*TIMESTAMP_SETTERS[column])(value);
+            }
+        }
+        for (size_t column = 0; column < STRING_COLUMNS; column++)
+        {
+            for (auto &reading : *readings)
+            {
+                uint64_t index;
+                if(!reader.readVarint(index) || index >= dictionarySize)
+                {
+                    EZMQ_LOG(ERROR, TAG, "Malformed string column");
+                    return EZMQ_ERROR;
+                }
+                *((reading.*STRING_SETTERS[column])()) = dictionary[index];
+            }
+        }
+        if(TYPED_FORMAT_VERSION == version && !readTypedColumns(reader, event))
+        {
+            EZMQ_LOG(ERROR, TAG, "Malformed typed value column");
+            return EZMQ_ERROR;
+        }
+        if(reader.remaining())
+        {
+            EZMQ_LOG(ERROR, TAG, "Trailing data after readings");
+            return EZMQ_ERROR;
+        }
+        return EZMQ_OK;
+    }
+}
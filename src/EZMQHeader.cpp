@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQHeader.h"
+#include "EZMQLogger.h"
+
+#define EZMQ_VERSION_1 1
+#define EZMQ_VERSION_2 2
+#define CONTENT_TYPE_OFFSET 5
+#define VERSION_OFFSET 2
+#define VERSION_MASK 0x07
+#define COMPRESSION_MASK 0x03
+#define EXTENSION_HEADER_SIZE 2
+#define SEQUENCE_SIZE 12
+#define TIMESTAMP_SIZE 8
+#define COMPRESSION_SIZE 1
+#define SCHEMA_ID_SIZE 4
+#define EXTENSION_BIT(type) (1u << (type))
+#define TAG "EZMQHeader"
+
+namespace ezmq
+{
+    static void writeBigEndian(unsigned char *out, uint64_t value, size_t bytes)
+    {
+        for (size_t i = bytes; i > 0; i--)
+        {
+            out[i - 1] = (unsigned char)value;
+            value >>= 8;
+        }
+    }
+
+    static uint64_t readBigEndian(const unsigned char *data, size_t bytes)
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+        {
+            value = (value << 8) | data[i];
+        }
+        return value;
+    }
+
+    static unsigned char *writeExtension(unsigned char *out, EZMQHeaderExtension type,
+        uint64_t value, size_t length)
+    {
+        out[0] = (unsigned char)type;
+        out[1] = (unsigned char)length;
+        writeBigEndian(out + EXTENSION_HEADER_SIZE, value, length);
+        return out + EXTENSION_HEADER_SIZE + length;
+    }
+
+    EZMQHeader::EZMQHeader()
+    {
+        mVersion = EZMQ_VERSION_1;
+        mContentType = 0;
+        mCodec = EZMQ_COMPRESSION_NONE;
+        mExtensions = 0;
+        mPublisherId = 0;
+        mSequence = 0;
+        mTimestamp = 0;
+        mSchemaId = 0;
+    }
+
+    EZMQErrorCode EZMQHeader::parse(const void *data, size_t size)
+    {
+        const unsigned char *header = (const unsigned char *)data;
+        if(NULL == header || 0 == size)
+        {
+            EZMQ_HOT_LOG(DEBUG, TAG, "Empty header");
+            return EZMQ_ERROR;
+        }
+        mContentType = header[0] >> CONTENT_TYPE_OFFSET;
+        mVersion = (header[0] >> VERSION_OFFSET) & VERSION_MASK;
+        mCodec = (EZMQCompressionCodec)(header[0] & COMPRESSION_MASK);
+        mExtensions = 0;
+        if(EZMQ_VERSION_1 == mVersion)
+        {
+            return EZMQ_OK;
+        }
+        if(EZMQ_VERSION_2 != mVersion)
+        {
+            EZMQ_HOT_LOG_V(DEBUG, TAG, "Not a supported version: %d", mVersion);
+            return EZMQ_ERROR;
+        }
+
+        size_t offset = 1;
+        while(offset < size)
+        {
+            if(size - offset < EXTENSION_HEADER_SIZE)
+            {
+                EZMQ_HOT_LOG(DEBUG, TAG, "Truncated extension");
+                return EZMQ_ERROR;
+            }
+            unsigned char type = header[offset];
+            size_t length = header[offset + 1];
+            const unsigned char *value = header + offset + EXTENSION_HEADER_SIZE;
+            offset += EXTENSION_HEADER_SIZE + length;
+            if(offset > size)
+            {
+                EZMQ_HOT_LOG(DEBUG, TAG, "Truncated extension");
+                return EZMQ_ERROR;
+            }
+
+            size_t expected;
+            switch(type)
+            {
+                case EZMQ_EXTENSION_SEQUENCE:
+                    expected = SEQUENCE_SIZE;
+                    break;
+                case EZMQ_EXTENSION_TIMESTAMP:
+                    expected = TIMESTAMP_SIZE;
+                    break;
+                case EZMQ_EXTENSION_COMPRESSION:
+                    expected = COMPRESSION_SIZE;
+                    break;
+                case EZMQ_EXTENSION_SCHEMA_ID:
+                    expected = SCHEMA_ID_SIZE;
+                    break;
+                default:
+                    // Extension of a newer publisher
+                    continue;
+            }
+            if(length != expected)
+            {
+                EZMQ_HOT_LOG_V(DEBUG, TAG, "Invalid length of extension: %d", type);
+                return EZMQ_ERROR;
+            }
+            mExtensions |= EXTENSION_BIT(type);
+            if(EZMQ_EXTENSION_SEQUENCE == type)
+            {
+                mPublisherId = (uint32_t)readBigEndian(value, 4);
+                mSequence = readBigEndian(value + 4, 8);
+            }
+            else if(EZMQ_EXTENSION_TIMESTAMP == type)
+            {
+                mTimestamp = readBigEndian(value, TIMESTAMP_SIZE);
+            }
+            else if(EZMQ_EXTENSION_COMPRESSION == type)
+            {
+                if(value[0] > EZMQ_COMPRESSION_ZSTD_DICT)
+                {
+                    EZMQ_HOT_LOG_V(DEBUG, TAG, "Invalid compression codec: %d", value[0]);
+                    return EZMQ_ERROR;
+                }
+                mCodec = (EZMQCompressionCodec)value[0];
+            }
+            else
+            {
+                mSchemaId = (uint32_t)readBigEndian(value, SCHEMA_ID_SIZE);
+            }
+        }
+        return EZMQ_OK;
+    }
+
+    size_t EZMQHeader::getSize() const
+    {
+        size_t size = 1;
+        if(hasSequence())
+        {
+            size += EXTENSION_HEADER_SIZE + SEQUENCE_SIZE;
+        }
+        if(hasTimestamp())
+        {
+            size += EXTENSION_HEADER_SIZE + TIMESTAMP_SIZE;
+        }
+        if(hasSchemaId())
+        {
+            size += EXTENSION_HEADER_SIZE + SCHEMA_ID_SIZE;
+        }
+        return size;
+    }
+
+    void EZMQHeader::write(unsigned char *out) const
+    {
+        // Codec always fits in codec bits, so compression extension is not written
+        int version = (0 == mExtensions) ? EZMQ_VERSION_1 : EZMQ_VERSION_2;
+        out[0] = (unsigned char)((mContentType << CONTENT_TYPE_OFFSET) |
+            (version << VERSION_OFFSET) | (mCodec & COMPRESSION_MASK));
+        out++;
+        if(hasSequence())
+        {
+            out[0] = EZMQ_EXTENSION_SEQUENCE;
+            out[1] = SEQUENCE_SIZE;
+            writeBigEndian(out + EXTENSION_HEADER_SIZE, mPublisherId, 4);
+            writeBigEndian(out + EXTENSION_HEADER_SIZE + 4, mSequence, 8);
+            out += EXTENSION_HEADER_SIZE + SEQUENCE_SIZE;
+        }
+        if(hasTimestamp())
+        {
+            out = writeExtension(out, EZMQ_EXTENSION_TIMESTAMP, mTimestamp, TIMESTAMP_SIZE);
+        }
+        if(hasSchemaId())
+        {
+            out = writeExtension(out, EZMQ_EXTENSION_SCHEMA_ID, mSchemaId, SCHEMA_ID_SIZE);
+        }
+    }
+
+    int EZMQHeader::getVersion() const
+    {
+        return mVersion;
+    }
+
+    int EZMQHeader::getContentType() const
+    {
+        return mContentType;
+    }
+
+    void EZMQHeader::setContentType(int contentType)
+    {
+        mContentType = contentType;
+    }
+
+    EZMQCompressionCodec EZMQHeader::getCompressionCodec() const
+    {
+        return mCodec;
+    }
+
+    void EZMQHeader::setCompressionCodec(EZMQCompressionCodec codec)
+    {
+        mCodec = codec;
+    }
+
+    bool EZMQHeader::hasSequence() const
+    {
+        return 0 != (mExtensions & EXTENSION_BIT(EZMQ_EXTENSION_SEQUENCE));
+    }
+
+    uint32_t EZMQHeader::getPublisherId() const
+    {
+        return mPublisherId;
+    }
+
+    uint64_t EZMQHeader::getSequence() const
+    {
+        return mSequence;
+    }
+
+    void EZMQHeader::setSequence(uint32_t publisherId, uint64_t sequence)
+    {
+        mExtensions |= EXTENSION_BIT(EZMQ_EXTENSION_SEQUENCE);
+        mPublisherId = publisherId;
+        mSequence = sequence;
+    }
+
+    bool EZMQHeader::hasTimestamp() const
+    {
+        return 0 != (mExtensions & EXTENSION_BIT(EZMQ_EXTENSION_TIMESTAMP));
+    }
+
+    uint64_t EZMQHeader::getTimestamp() const
+    {
+        return mTimestamp;
+    }
+
+    void EZMQHeader::setTimestamp(uint64_t timestamp)
+    {
+        mExtensions |= EXTENSION_BIT(EZMQ_EXTENSION_TIMESTAMP);
+        mTimestamp = timestamp;
+    }
+
+    bool EZMQHeader::hasSchemaId() const
+    {
+        return 0 != (mExtensions & EXTENSION_BIT(EZMQ_EXTENSION_SCHEMA_ID));
+    }
+
+    uint32_t EZMQHeader::getSchemaId() const
+    {
+        return mSchemaId;
+    }
+
+    void EZMQHeader::setSchemaId(uint32_t schemaId)
+    {
+        mExtensions |= EXTENSION_BIT(EZMQ_EXTENSION_SCHEMA_ID);
+        mSchemaId = schemaId;
+    }
+}
@@ -0,0 +1,954 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+
+#include "EZMQJsonData.h"
+#include "Event.pb.h"
+#include "EZMQLogger.h"
+#include "EZMQTypedValue.h"
+
+#define MAX_DEPTH 64
+#define TAG "EZMQJsonData"
+
+namespace ezmq
+{
+    static void appendString(std::string &out, const std::string &value)
+    {
+        static const char hex[] = "0123456789abcdef";
+        out += '"';
+        size_t start = 0;
+        for (size_t i = 0; i < value.size(); i++)
+        {
+            unsigned char c = value[i];
+            if(c >= 0x20 && c != '"' && c != '\\')
+            {
+                continue;
+            }
+            // append plain characters at once
+            out.append(value, start, i - start);
+            start = i + 1;
+            switch(c)
+            {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    out += "\\u00";
+                    out += hex[c >> 4];
+                    out += hex[c & 0x0F];
+            }
+        }
+        out.append(value, start, std::string::npos);
+        out += '"';
+    }
+
+    static void appendInt64(std::string &out, int64_t value)
+    {
+        char buffer[24];
+        char *end = buffer + sizeof(buffer);
+        char *p = end;
+        uint64_t magnitude = (value < 0) ? (0 - (uint64_t)value) : (uint64_t)value;
+        do
+        {
+            *--p = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while(magnitude);
+        if(value < 0)
+        {
+            *--p = '-';
+        }
+        out.append(p, end - p);
+    }
+
+    // int64 is a string in protobuf JSON mapping, as JSON numbers are doubles
+    static void appendInt64String(std::string &out, int64_t value)
+    {
+        out += '"';
+        appendInt64(out, value);
+        out += '"';
+    }
+
+    // Non-finite values are strings in protobuf JSON mapping
+    static void appendDouble(std::string &out, double value)
+    {
+        if(std::isnan(value))
+        {
+            out += "\"NaN\"";
+        }
+        else if(std::isinf(value))
+        {
+            out += (value < 0) ? "\"-Infinity\"" : "\"Infinity\"";
+        }
+        else
+        {
+            // 17 significant digits restore the same double
+            char buffer[32];
+            int size = snprintf(buffer, sizeof(buffer), "%.17g", value);
+            out.append(buffer, size);
+        }
+    }
+
+    // bytes are standard base64 with padding in protobuf JSON mapping
+    static void appendBase64(std::string &out, const std::string &value)
+    {
+        static const char alphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        out += '"';
+        size_t i = 0;
+        for (; i + 2 < value.size(); i += 3)
+        {
+            uint32_t bits = ((uint8_t)value[i] << 16) | ((uint8_t)value[i + 1] << 8) |
+                (uint8_t)value[i + 2];
+            out += alphabet[bits >> 18];
+            out += alphabet[(bits >> 12) & 0x3F];
+            out += alphabet[(bits >> 6) & 0x3F];
+            out += alphabet[bits & 0x3F];
+        }
+        if(i < value.size())
+        {
+            uint32_t bits = (uint8_t)value[i] << 16;
+            if(i + 1 < value.size())
+            {
+                bits |= (uint8_t)value[i + 1] << 8;
+            }
+            out += alphabet[bits >> 18];
+            out += alphabet[(bits >> 12) & 0x3F];
+            out += (i + 1 < value.size()) ? alphabet[(bits >> 6) & 0x3F] : '=';
+            out += '=';
+        }
+        out += '"';
+    }
+
+    // Accepts standard and URL-safe alphabets, padding is optional
+    static bool decodeBase64(const std::string &text, std::string &value)
+    {
+        value.clear();
+        uint32_t bits = 0;
+        int count = 0;
+        size_t size = text.size();
+        while(size && '=' == text[size - 1] && text.size() - size < 2)
+        {
+            size--;
+        }
+        for (size_t i = 0; i < size; i++)
+        {
+            char c = text[i];
+            uint32_t digit;
+            if(c >= 'A' && c <= 'Z')
+            {
+                digit = c - 'A';
+            }
+            else if(c >= 'a' && c <= 'z')
+            {
+                digit = c - 'a' + 26;
+            }
+            else if(c >= '0' && c <= '9')
+            {
+                digit = c - '0' + 52;
+            }
+            else if('+' == c || '-' == c)
+            {
+                digit = 62;
+            }
+            else if('/' == c || '_' == c)
+            {
+                digit = 63;
+            }
+            else
+            {
+                return false;
+            }
+            bits = (bits << 6) | digit;
+            if(4 == ++count)
+            {
+                value += (char)(bits >> 16);
+                value += (char)(bits >> 8);
+                value += (char)bits;
+                bits = 0;
+                count = 0;
+            }
+        }
+        if(1 == count)
+        {
+            return false;
+        }
+        if(count)
+        {
+            bits <<= 6 * (4 - count);
+            value += (char)(bits >> 16);
+            if(3 == count)
+            {
+                value += (char)(bits >> 8);
+            }
+        }
+        return true;
+    }
+
+    static void appendField(std::string &out, const char *key, bool first = false)
+    {
+        if(!first)
+        {
+            out += ',';
+        }
+        out += '"';
+        out += key;
+        out += "\":";
+    }
+
+    // Single pass JSON reader, values are read in place without building a document
+    class JsonReader
+    {
+        public:
+            JsonReader(const char *data, size_t size) : mPos(data), mEnd(data + size), mDepth(0) {}
+
+            bool atEnd()
+            {
+                skipWhitespace();
+                return mPos == mEnd;
+            }
+
+            // value can be NULL for validating only
+            bool readString(std::string *value)
+            {
+                skipWhitespace();
+                if(mPos == mEnd || '"' != *mPos)
+                {
+                    return false;
+                }
+                mPos++;
+                if(value)
+                {
+                    value->clear();
+                }
+                const char *start = mPos;
+                while(mPos != mEnd)
+                {
+                    unsigned char c = *mPos;
+                    if('"' == c || '\\' == c)
+                    {
+                        if(value)
+                        {
+                            value->append(start, mPos - start);
+                        }
+                        mPos++;
+                        if('"' == c)
+                        {
+                            return true;
+                        }
+                        if(!readEscape(value))
+                        {
+                            return false;
+                        }
+                        start = mPos;
+                    }
+                    else if(c < 0x20)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        mPos++;
+                    }
+                }
+                return false;
+            }
+
+            // int64 can be a number or a string as in protobuf JSON mapping
+            bool readInt64(int64_t &value)
+            {
+                skipWhitespace();
+                bool quoted = (mPos != mEnd && '"' == *mPos);
+                if(quoted)
+                {
+                    mPos++;
+                }
+                bool negative = (mPos != mEnd && '-' == *mPos);
+                if(negative)
+                {
+                    mPos++;
+                }
+                if(mPos == mEnd || *mPos < '0' || *mPos > '9')
+                {
+                    return false;
+                }
+                uint64_t limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+                uint64_t magnitude = 0;
+                while(mPos != mEnd && *mPos >= '0' && *mPos <= '9')
+                {
+                    unsigned digit = *mPos - '0';
+                    if(magnitude > (limit - digit) / 10)
+                    {
+                        return false;
+                    }
+                    magnitude = magnitude * 10 + digit;
+                    mPos++;
+                }
+                if(quoted && (mPos == mEnd || '"' != *mPos++))
+                {
+                    return false;
+                }
+                value = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+                return true;
+            }
+
+            // double can be a number or a string, "NaN", "Infinity" and "-Infinity"
+            // are strings as in protobuf JSON mapping
+            bool readDouble(double &value)
+            {
+                skipWhitespace();
+                if(mPos == mEnd)
+                {
+                    return false;
+                }
+                if('"' != *mPos)
+                {
+                    const char *start = mPos;
+                    return skipNumber() && parseDouble(start, mPos - start, value);
+                }
+                std::string text;
+                if(!readString(&text))
+                {
+                    return false;
+                }
+                if("NaN" == text)
+                {
+                    value = NAN;
+                }
+                else if("Infinity" == text)
+                {
+                    value = INFINITY;
+                }
+                else if("-Infinity" == text)
+                {
+                    value = -INFINITY;
+                }
+                else
+                {
+                    JsonReader number(text.c_str(), text.size());
+                    return !text.empty() && '"' != text[0] && number.readDouble(value) &&
+                        number.atEnd();
+                }
+                return true;
+            }
+
+            // bytes are base64 strings
+            bool readBytes(std::string *value)
+            {
+                std::string text;
+                return readString(&text) && decodeBase64(text, *value);
+            }
+
+            // Reads members of object, onField(key) reads value of each member
+            template<typename OnField>
+            bool readObject(OnField onField)
+            {
+                if(!consume('{') || !enter())
+                {
+                    return false;
+                }
+                if(consume('}'))
+                {
+                    return leave();
+                }
+                std::string key;
+                do
+                {
+                    if(!readString(&key) || !consume(':') || !onField(key))
+                    {
+                        return false;
+                    }
+                } while(consume(','));
+                return consume('}') && leave();
+            }
+
+            // Reads elements of array, onElement() reads each element
+            template<typename OnElement>
+            bool readArray(OnElement onElement)
+            {
+                if(!consume('[') || !enter())
+                {
+                    return false;
+                }
+                if(consume(']'))
+                {
+                    return leave();
+                }
+                do
+                {
+                    if(!onElement())
+                    {
+                        return false;
+                    }
+                } while(consume(','));
+                return consume(']') && leave();
+            }
+
+            bool skipValue()
+            {
+                skipWhitespace();
+                if(mPos == mEnd)
+                {
+                    return false;
+                }
+                switch(*mPos)
+                {
+                    case '{':
+                        return readObject([this](const std::string &) { return skipValue(); });
+                    case '[':
+                        return readArray([this]() { return skipValue(); });
+                    case '"':
+                        return readString(NULL);
+                    case 't':
+                        return skipLiteral("true");
+                    case 'f':
+                        return skipLiteral("false");
+                    case 'n':
+                        return skipLiteral("null");
+                    default:
+                        return skipNumber();
+                }
+            }
+
+        private:
+            const char *mPos;
+            const char *mEnd;
+            int mDepth;
+
+            void skipWhitespace()
+            {
+                while(mPos != mEnd && (' ' == *mPos || '\n' == *mPos || '\r' == *mPos ||
+                    '\t' == *mPos))
+                {
+                    mPos++;
+                }
+            }
+
+            bool consume(char c)
+            {
+                skipWhitespace();
+                if(mPos != mEnd && c == *mPos)
+                {
+                    mPos++;
+                    return true;
+                }
+                return false;
+            }
+
+            bool enter()
+            {
+                return ++mDepth <= MAX_DEPTH;
+            }
+
+            bool leave()
+            {
+                mDepth--;
+                return true;
+            }
+
+            bool skipLiteral(const char *literal)
+            {
+                for (; *literal; literal++, mPos++)
+                {
+                    if(mPos == mEnd || *mPos != *literal)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool skipDigits()
+            {
+                const char *start = mPos;
+                while(mPos != mEnd && *mPos >= '0' && *mPos <= '9')
+                {
+                    mPos++;
+                }
+                return mPos != start;
+            }
+
+            // number is already checked by skipNumber()
+            static bool parseDouble(const char *number, size_t size, double &value)
+            {
+                char buffer[64];
+                std::string longNumber;
+                const char *text = buffer;
+                if(size < sizeof(buffer))
+                {
+                    memcpy(buffer, number, size);
+                    buffer[size] = '\0';
+                }
+                else
+                {
+                    longNumber.assign(number, size);
+                    text = longNumber.c_str();
+                }
+                char *end = NULL;
+                value = strtod(text, &end);
+                return end == text + size;
+            }
+
+            bool skipNumber()
+            {
+                if('-' == *mPos)
+                {
+                    mPos++;
+                }
+                if(mPos != mEnd && '0' == *mPos)
+                {
+                    mPos++;
+                }
+                else if(!skipDigits())
+                {
+                    return false;
+                }
+                if(mPos != mEnd && '.' == *mPos)
+                {
+                    mPos++;
+                    if(!skipDigits())
+                    {
+                        return false;
+                    }
+                }
+                if(mPos != mEnd && ('e' == *mPos || 'E' == *mPos))
+                {
+                    mPos++;
+                    if(mPos != mEnd && ('+' == *mPos || '-' == *mPos))
+                    {
+                        mPos++;
+                    }
+                    return skipDigits();
+                }
+                return true;
+            }
+
+            bool readHex(unsigned &code)
+            {
+                code = 0;
+                for (int i = 0; i < 4; i++, mPos++)
+                {
+                    if(mPos == mEnd)
+                    {
+                        return false;
+                    }
+                    char c = *mPos;
+                    unsigned digit;
+                    if(c >= '0' && c <= '9')
+                    {
+                        digit = c - '0';
+                    }
+                    else if(c >= 'a' && c <= 'f')
+                    {
+                        digit = c - 'a' + 10;
+                    }
+                    else if(c >= 'A' && c <= 'F')
+                    {
+                        digit = c - 'A' + 10;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    code = (code << 4) | digit;
+                }
+                return true;
+            }
+
+            bool readEscape(std::string *value)
+            {
+                if(mPos == mEnd)
+                {
+                    return false;
+                }
+                char c = *mPos++;
+                char decoded;
+                switch(c)
+                {
+                    case '"': decoded = '"'; break;
+                    case '\\': decoded = '\\'; break;
+                    case '/': decoded = '/'; break;
+                    case 'b': decoded = '\b'; break;
+                    case 'f': decoded = '\f'; break;
+                    case 'n': decoded = '\n'; break;
+                    case 'r': decoded = '\r'; break;
+                    case 't': decoded = '\t'; break;
+                    case 'u': return readUnicode(value);
+                    default: return false;
+                }
+                if(value)
+                {
+                    *value += decoded;
+                }
+                return true;
+            }
+
+            bool readUnicode(std::string *value)
+            {
+                unsigned code;
+                if(!readHex(code))
+                {
+                    return false;
+                }
+                if(code >= 0xD800 && code <= 0xDBFF)
+                {
+                    // surrogate pair
+                    unsigned low;
+                    if(mEnd - mPos < 2 || '\\' != mPos[0] || 'u' != mPos[1])
+                    {
+                        return false;
+                    }
+                    mPos += 2;
+                    if(!readHex(low) || low < 0xDC00 || low > 0xDFFF)
+                    {
+                        return false;
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                else if(code >= 0xDC00 && code <= 0xDFFF)
+                {
+                    return false;
+                }
+                if(!value)
+                {
+                    return true;
+                }
+                // encode as UTF-8
+                if(code < 0x80)
+                {
+                    *value += (char)code;
+                }
+                else if(code < 0x800)
+                {
+                    *value += (char)(0xC0 | (code >> 6));
+                    *value += (char)(0x80 | (code & 0x3F));
+                }
+                else if(code < 0x10000)
+                {
+                    *value += (char)(0xE0 | (code >> 12));
+                    *value += (char)(0x80 | ((code >> 6) & 0x3F));
+                    *value += (char)(0x80 | (code & 0x3F));
+                }
+                else
+                {
+                    *value += (char)(0xF0 | (code >> 18));
+                    *value += (char)(0x80 | ((code >> 12) & 0x3F));
+                    *value += (char)(0x80 | ((code >> 6) & 0x3F));
+                    *value += (char)(0x80 | (code & 0x3F));
+                }
+                return true;
+            }
+    };
+
+    static bool isTimestamp(const std::string &key)
+    {
+        return "created" == key || "modified" == key || "origin" == key || "pushed" == key;
+    }
+
+    // Sets timestamp field of Event or Reading
+    template<typename T>
+    static bool readTimestamp(JsonReader &reader, T &message, const std::string &key)
+    {
+        int64_t value = 0;
+        if(!reader.readInt64(value))
+        {
+            return false;
+        }
+        if("created" == key)
+        {
+            message.set_created(value);
+        }
+        else if("modified" == key)
+        {
+            message.set_modified(value);
+        }
+        else if("origin" == key)
+        {
+            message.set_origin(value);
+        }
+        else
+        {
+            message.set_pushed(value);
+        }
+        return true;
+    }
+
+    static bool readReadingField(JsonReader &reader, Reading &reading, const std::string &key)
+    {
+        if("id" == key)
+        {
+            return reader.readString(reading.mutable_id());
+        }
+        else if("name" == key)
+        {
+            return reader.readString(reading.mutable_name());
+        }
+        else if("value" == key)
+        {
+            return reader.readString(reading.mutable_value());
+        }
+        else if("device" == key)
+        {
+            return reader.readString(reading.mutable_device());
+        }
+        else if(isTimestamp(key))
+        {
+            return readTimestamp(reader, reading, key);
+        }
+        // Typed values, lowerCamelCase as written and proto field names
+        else if("doubleValue" == key || "double_value" == key)
+        {
+            double value = 0;
+            if(!reader.readDouble(value))
+            {
+                return false;
+            }
+            reading.set_double_value(value);
+            return true;
+        }
+        else if("intValue" == key || "int_value" == key)
+        {
+            int64_t value = 0;
+            if(!reader.readInt64(value))
+            {
+                return false;
+            }
+            reading.set_int_value(value);
+            return true;
+        }
+        else if("binaryValue" == key || "binary_value" == key)
+        {
+            return reader.readBytes(reading.mutable_binary_value());
+        }
+        else if("doubleValues" == key || "double_values" == key)
+        {
+            reading.clear_double_values();
+            return reader.readArray([&reader, &reading]()
+            {
+                double value = 0;
+                if(!reader.readDouble(value))
+                {
+                    return false;
+                }
+                reading.add_double_values(value);
+                return true;
+            });
+        }
+        else if("intValues" == key || "int_values" == key)
+        {
+            reading.clear_int_values();
+            return reader.readArray([&reader, &reading]()
+            {
+                int64_t value = 0;
+                if(!reader.readInt64(value))
+                {
+                    return false;
+                }
+                reading.add_int_values(value);
+                return true;
+            });
+        }
+        return reader.skipValue();
+    }
+
+    // Typed values are written only if set, so readings without them keep their JSON
+    static void appendTypedValues(std::string &json, const Reading &reading)
+    {
+        if(reading.has_double_value())
+        {
+            appendField(json, "doubleValue");
+            appendDouble(json, reading.double_value());
+        }
+        if(reading.has_int_value())
+        {
+            appendField(json, "intValue");
+            appendInt64String(json, reading.int_value());
+        }
+        if(reading.has_binary_value())
+        {
+            appendField(json, "binaryValue");
+            appendBase64(json, reading.binary_value());
+        }
+        if(reading.double_values_size())
+        {
+            appendField(json, "doubleValues");
+            json += '[';
+            for (int i = 0; i < reading.double_values_size(); i++)
+            {
+                if(i)
+                {
+                    json += ',';
+                }
+                appendDouble(json, reading.double_values(i));
+            }
+            json += ']';
+        }
+        if(reading.int_values_size())
+        {
+            appendField(json, "intValues");
+            json += '[';
+            for (int i = 0; i < reading.int_values_size(); i++)
+            {
+                if(i)
+                {
+                    json += ',';
+                }
+                appendInt64String(json, reading.int_values(i));
+            }
+            json += ']';
+        }
+    }
+
+    static bool readEventField(JsonReader &reader, Event &event, const std::string &key)
+    {
+        if("id" == key)
+        {
+            return reader.readString(event.mutable_id());
+        }
+        else if("device" == key)
+        {
+            return reader.readString(event.mutable_device());
+        }
+        else if(isTimestamp(key))
+        {
+            return readTimestamp(reader, event, key);
+        }
+        else if("reading" == key)
+        {
+            return reader.readArray([&reader, &event]()
+            {
+                Reading *reading = event.add_reading();
+                return reader.readObject([&reader, reading](const std::string &field)
+                {
+                    return readReadingField(reader, *reading, field);
+                });
+            });
+        }
+        return reader.skipValue();
+    }
+
+    EZMQJsonData::EZMQJsonData(const std::string &json) : mJson(json)
+    {
+        mContentType = EZMQ_CONTENT_TYPE_JSON;
+    }
+
+    EZMQJsonData::~EZMQJsonData()
+    {
+    }
+
+    const std::string &EZMQJsonData::getJson() const
+    {
+        return mJson;
+    }
+
+    EZMQErrorCode EZMQJsonData::setJson(const std::string &json)
+    {
+        if(!isValid(json.c_str(), json.size()))
+        {
+            EZMQ_LOG(ERROR, TAG, "Not a valid JSON");
+            return EZMQ_ERROR;
+        }
+        mJson = json;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQJsonData::setEvent(const Event &event)
+    {
+        std::string json;
+        json.reserve(256 + event.reading_size() * 192);
+        json += '{';
+        appendField(json, "id", true);
+        appendString(json, event.id());
+        appendField(json, "created");
+        appendInt64(json, event.created());
+        appendField(json, "modified");
+        appendInt64(json, event.modified());
+        appendField(json, "origin");
+        appendInt64(json, event.origin());
+        appendField(json, "pushed");
+        appendInt64(json, event.pushed());
+        appendField(json, "device");
+        appendString(json, event.device());
+        appendField(json, "reading");
+        json += '[';
+        for (int i = 0; i < event.reading_size(); i++)
+        {
+            const Reading &reading = event.reading(i);
+            if(i)
+            {
+                json += ',';
+            }
+            json += '{';
+            appendField(json, "id", true);
+            appendString(json, reading.id());
+            appendField(json, "created");
+            appendInt64(json, reading.created());
+            appendField(json, "modified");
+            appendInt64(json, reading.modified());
+            appendField(json, "origin");
+            appendInt64(json, reading.origin());
+            appendField(json, "pushed");
+            appendInt64(json, reading.pushed());
+            appendField(json, "name");
+            appendString(json, reading.name());
+            appendField(json, "value");
+            appendString(json, reading.value());
+            appendField(json, "device");
+            appendString(json, reading.device());
+            if(hasTypedValue(reading))
+            {
+                appendTypedValues(json, reading);
+            }
+            json += '}';
+        }
+        json += "]}";
+        mJson.swap(json);
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQJsonData::getEvent(Event &event) const
+    {
+        event.Clear();
+        JsonReader reader(mJson.c_str(), mJson.size());
+        bool result = reader.readObject([&reader, &event](const std::string &key)
+        {
+            return readEventField(reader, event, key);
+        });
+        if(!result || !reader.atEnd() || !event.IsInitialized())
+        {
+            EZMQ_LOG(ERROR, TAG, "Not a valid JSON event");
+            return EZMQ_ERROR;
+        }
+        return EZMQ_OK;
+    }
+
+    bool EZMQJsonData::isValid(const char *data, size_t size)
+    {
+        if(NULL == data)
+        {
+            return false;
+        }
+        JsonReader reader(data, size);
+        return reader.skipValue() && reader.atEnd();
+    }
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include "EZMQLatencyHistogram.h"
+
+// Values below 2 * SUB_BUCKET_COUNT are recorded exactly, larger values are
+// split into SUB_BUCKET_COUNT buckets per power of two
+#define SUB_BUCKET_BITS 5
+#define SUB_BUCKET_COUNT (1 << SUB_BUCKET_BITS)
+#define BUCKET_COUNT ((64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT)
+
+namespace ezmq
+{
+    static int highestBit(uint64_t value)
+    {
+        int bit = 0;
+        while(value >>= 1)
+        {
+            bit++;
+        }
+        return bit;
+    }
+
+    EZMQLatencyHistogram::EZMQLatencyHistogram() : mCounts(BUCKET_COUNT, 0)
+    {
+        mTotalCount = 0;
+        mMin = 0;
+        mMax = 0;
+        mSum = 0;
+    }
+
+    size_t EZMQLatencyHistogram::getBucket(uint64_t value)
+    {
+        if(value < 2 * SUB_BUCKET_COUNT)
+        {
+            return (size_t)value;
+        }
+        int shift = highestBit(value) - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKET_COUNT + (size_t)(value >> shift) - SUB_BUCKET_COUNT;
+    }
+
+    uint64_t EZMQLatencyHistogram::getBucketUpperBound(size_t bucket)
+    {
+        if(bucket < 2 * SUB_BUCKET_COUNT)
+        {
+            return bucket;
+        }
+        int shift = bucket / SUB_BUCKET_COUNT - 1;
+        uint64_t top = bucket % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return ((top + 1) << shift) - 1;
+    }
+
+    void EZMQLatencyHistogram::record(uint64_t value)
+    {
+        mCounts[getBucket(value)]++;
+        if(0 == mTotalCount || value < mMin)
+        {
+            mMin = value;
+        }
+        if(value > mMax)
+        {
+            mMax = value;
+        }
+        mSum += value;
+        mTotalCount++;
+    }
+
+    void EZMQLatencyHistogram::merge(const EZMQLatencyHistogram &other)
+    {
+        if(0 == other.mTotalCount)
+        {
+            return;
+        }
+        for (size_t i = 0; i < mCounts.size(); i++)
+        {
+            mCounts[i] += other.mCounts[i];
+        }
+        if(0 == mTotalCount || other.mMin < mMin)
+        {
+            mMin = other.mMin;
+        }
+        if(other.mMax > mMax)
+        {
+            mMax = other.mMax;
+        }
+        mSum += other.mSum;
+        mTotalCount += other.mTotalCount;
+    }
+
+    void EZMQLatencyHistogram::reset()
+    {
+        std::fill(mCounts.begin(), mCounts.end(), 0);
+        mTotalCount = 0;
+        mMin = 0;
+        mMax = 0;
+        mSum = 0;
+    }
+
+    uint64_t EZMQLatencyHistogram::getCount() const
+    {
+        return mTotalCount;
+    }
+
+    uint64_t EZMQLatencyHistogram::getMin() const
+    {
+        return mMin;
+    }
+
+    uint64_t EZMQLatencyHistogram::getMax() const
+    {
+        return mMax;
+    }
+
+    double EZMQLatencyHistogram::getMean() const
+    {
+        return 0 == mTotalCount ? 0 : mSum / mTotalCount;
+    }
+
+    uint64_t EZMQLatencyHistogram::getPercentile(double percentile) const
+    {
+        if(0 == mTotalCount)
+        {
+            return 0;
+        }
+        // Clamped to [0, 100], NaN is taken as 0
+        if(!(percentile >= 0))
+        {
+            percentile = 0;
+        }
+        else if(percentile > 100)
+        {
+            percentile = 100;
+        }
+        // Rank of the value at percentile, at least the first value
+        uint64_t rank = (uint64_t)(percentile / 100 * mTotalCount + 0.5);
+        if(rank < 1)
+        {
+            rank = 1;
+        }
+        uint64_t count = 0;
+        for (size_t i = 0; i < mCounts.size(); i++)
+        {
+            count += mCounts[i];
+            if(count >= rank)
+            {
+                uint64_t value = getBucketUpperBound(i);
+                return value < mMax ? value : mMax;
+            }
+        }
+        return mMax;
+    }
+}
@@ -22,6 +22,13 @@
 
 namespace ezmq
 {
+    EZMQMessage::EZMQMessage()
+    {
+        mVersion = 0;
+        mContentType = EZMQ_CONTENT_TYPE_PROTOBUF;
+        mSchemaId = 0;
+    }
+
     EZMQContentType EZMQMessage::getContentType() const
     {
         return mContentType;
@@ -38,6 +45,16 @@ namespace ezmq
         return EZMQ_OK;
     }
 
+    uint32_t EZMQMessage::getSchemaId() const
+    {
+        return mSchemaId;
+    }
+
+    void EZMQMessage::setSchemaId(uint32_t schemaId)
+    {
+        mSchemaId = schemaId;
+    }
+
     int EZMQMessage::getEZMQVersion() const
     {
         return mVersion;
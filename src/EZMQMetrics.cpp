@@ -0,0 +1,336 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+
+#include "EZMQMetrics.h"
+#include "EZMQLogger.h"
+
+#define TAG "EZMQMetrics"
+
+namespace ezmq
+{
+    namespace
+    {
+        struct MetricInfo
+        {
+            const char *name;
+            const char *help;
+            bool isTime;
+        };
+
+        // Indexed by EZMQMetric
+        const MetricInfo METRIC_INFO[EZMQ_METRIC_COUNT] =
+        {
+            {"ezmq_messages_sent_total", "Messages sent.", false},
+            {"ezmq_sent_bytes_total", "Bytes sent, including topic and header frames.", false},
+            {"ezmq_send_failures_total", "Messages failed to be sent.", false},
+            {"ezmq_serialization_seconds_total", "Time spent serializing and compressing messages.", true},
+            {"ezmq_messages_received_total", "Messages received.", false},
+            {"ezmq_received_bytes_total", "Bytes received, including topic and header frames.", false},
+            {"ezmq_callback_seconds_total", "Time spent in application callbacks.", true}
+        };
+
+        // Shard counters of last topic counted by the thread
+        struct SlotCache
+        {
+            uint64_t owner;
+            std::string topic;
+            void *counters;
+        };
+
+        thread_local SlotCache slotCache = {0, std::string(), NULL};
+
+        std::atomic<uint64_t> nextId(1);
+
+        std::atomic<uint32_t> nextShard(0);
+
+        // Shard of calling thread, assigned round robin on first use
+        size_t threadShard()
+        {
+            static thread_local size_t shard = nextShard++ % EZMQ_METRIC_SHARDS;
+            return shard;
+        }
+
+        std::string escapeLabel(const std::string &value)
+        {
+            std::string escaped;
+            for (char c : value)
+            {
+                if('\\' == c || '"' == c)
+                {
+                    escaped += '\\';
+                    escaped += c;
+                }
+                else if('\n' == c)
+                {
+                    escaped += "\\n";
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+    }
+
+    EZMQMetrics::Slot::Slot()
+    {
+        for (auto &shard : shards)
+        {
+            for (auto &counter : shard.counters)
+            {
+                counter = 0;
+            }
+        }
+    }
+
+    uint64_t EZMQMetrics::Slot::sum(size_t metric) const
+    {
+        uint64_t value = 0;
+        for (const auto &shard : shards)
+        {
+            value += shard.counters[metric].load(std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    EZMQMetrics::EZMQMetrics(const std::string &socket) : mSocket(socket), mId(nextId++),
+        mEnabled(true)
+    {
+    }
+
+    std::atomic<uint64_t> *EZMQMetrics::getCounters(const std::string &topic)
+    {
+        if(mId == slotCache.owner && topic == slotCache.topic)
+        {
+            return static_cast<std::atomic<uint64_t> *>(slotCache.counters);
+        }
+        Slot *slot;
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            std::unique_ptr<Slot> &entry = mSlots[topic];
+            if(!entry)
+            {
+                entry.reset(new Slot());
+            }
+            slot = entry.get();
+        }
+        // Slots live as long as the instance, reset only zeroes them
+        std::atomic<uint64_t> *counters = slot->shards[threadShard()].counters;
+        slotCache.owner = mId;
+        slotCache.topic = topic;
+        slotCache.counters = counters;
+        return counters;
+    }
+
+    void EZMQMetrics::add(const std::string &topic, EZMQMetric metric, uint64_t value)
+    {
+        if(!mEnabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        getCounters(topic)[metric].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void EZMQMetrics::add(const std::string &topic,
+        std::initializer_list<std::pair<EZMQMetric, uint64_t>> values)
+    {
+        if(!mEnabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        std::atomic<uint64_t> *counters = getCounters(topic);
+        for (const auto &value : values)
+        {
+            counters[value.first].fetch_add(value.second, std::memory_order_relaxed);
+        }
+    }
+
+    void EZMQMetrics::setEnabled(bool enable)
+    {
+        mEnabled = enable;
+    }
+
+    bool EZMQMetrics::isEnabled() const
+    {
+        return mEnabled;
+    }
+
+    std::map<std::string, EZMQMetrics::Counters> EZMQMetrics::collect() const
+    {
+        std::map<std::string, Counters> topics;
+        std::lock_guard<std::mutex> lock(mLock);
+        for (const auto &entry : mSlots)
+        {
+            Counters counters(EZMQ_METRIC_COUNT, 0);
+            bool counted = false;
+            for (size_t i = 0; i < EZMQ_METRIC_COUNT; i++)
+            {
+                counters[i] = entry.second->sum(i);
+                counted = counted || 0 != counters[i];
+            }
+            // Topics not counted since reset are left out
+            if(counted)
+            {
+                topics[entry.first].swap(counters);
+            }
+        }
+        return topics;
+    }
+
+    uint64_t EZMQMetrics::getValue(EZMQMetric metric) const
+    {
+        uint64_t value = 0;
+        std::lock_guard<std::mutex> lock(mLock);
+        for (const auto &entry : mSlots)
+        {
+            value += entry.second->sum(metric);
+        }
+        return value;
+    }
+
+    uint64_t EZMQMetrics::getValue(EZMQMetric metric, const std::string &topic) const
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        auto it = mSlots.find(topic);
+        if(it == mSlots.end())
+        {
+            return 0;
+        }
+        return it->second->sum(metric);
+    }
+
+    std::vector<std::string> EZMQMetrics::getTopics() const
+    {
+        std::vector<std::string> topics;
+        for (const auto &topic : collect())
+        {
+            topics.push_back(topic.first);
+        }
+        return topics;
+    }
+
+    void EZMQMetrics::reset()
+    {
+        // Slots may be cached by threads, so they are zeroed instead of removed
+        std::lock_guard<std::mutex> lock(mLock);
+        for (auto &entry : mSlots)
+        {
+            for (auto &shard : entry.second->shards)
+            {
+                for (auto &counter : shard.counters)
+                {
+                    counter = 0;
+                }
+            }
+        }
+    }
+
+    std::string EZMQMetrics::toPrometheus() const
+    {
+        std::map<std::string, Counters> topics = collect();
+        std::string socket = escapeLabel(mSocket);
+        std::ostringstream out;
+        for (size_t i = 0; i < EZMQ_METRIC_COUNT; i++)
+        {
+            // Metrics of the other socket type stay zero, they are left out
+            bool counted = false;
+            for (const auto &topic : topics)
+            {
+                counted = counted || 0 != topic.second[i];
+            }
+            if(!counted)
+            {
+                continue;
+            }
+            const MetricInfo &info = METRIC_INFO[i];
+            out << "# HELP " << info.name << " " << info.help << "\n";
+            out << "# TYPE " << info.name << " counter\n";
+            for (const auto &topic : topics)
+            {
+                out << info.name << "{socket=\"" << socket << "\",topic=\"" <<
+                    escapeLabel(topic.first) << "\"} ";
+                if(info.isTime)
+                {
+                    out << topic.second[i] / 1e9 << "\n";
+                }
+                else
+                {
+                    out << topic.second[i] << "\n";
+                }
+            }
+        }
+        return out.str();
+    }
+
+    EZMQErrorCode EZMQMetrics::writePrometheus(const std::string &path) const
+    {
+        // Write aside and rename, so a reader never sees partial content
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath.c_str(), std::ios::out | std::ios::trunc);
+            if(!file)
+            {
+                EZMQ_LOG_V(ERROR, TAG, "Failed to open: %s", tempPath.c_str());
+                return EZMQ_ERROR;
+            }
+            file << toPrometheus();
+            if(!file.flush())
+            {
+                EZMQ_LOG_V(ERROR, TAG, "Failed to write: %s", tempPath.c_str());
+                return EZMQ_ERROR;
+            }
+        }
+        if(0 != rename(tempPath.c_str(), path.c_str()))
+        {
+            // Windows does not replace existing file on rename
+            remove(path.c_str());
+            if(0 != rename(tempPath.c_str(), path.c_str()))
+            {
+                EZMQ_LOG_V(ERROR, TAG, "Failed to rename: %s", path.c_str());
+                remove(tempPath.c_str());
+                return EZMQ_ERROR;
+            }
+        }
+        return EZMQ_OK;
+    }
+
+    EZMQMetrics::ScopeTimer::ScopeTimer(EZMQMetrics &metrics, const std::string &topic,
+        EZMQMetric metric) : mCounter(NULL)
+    {
+        if(metrics.isEnabled())
+        {
+            mCounter = &(metrics.getCounters(topic)[metric]);
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+
+    EZMQMetrics::ScopeTimer::~ScopeTimer()
+    {
+        if(NULL == mCounter)
+        {
+            return;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - mStart;
+        mCounter->fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+    }
+}
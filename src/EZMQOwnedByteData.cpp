@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQOwnedByteData.h"
+#include "EZMQLogger.h"
+
+#define TAG "EZMQOwnedByteData"
+
+namespace ezmq
+{
+    EZMQOwnedByteData::EZMQOwnedByteData() : EZMQByteData(NULL, 0)
+    {
+    }
+
+    EZMQOwnedByteData::EZMQOwnedByteData(zmq::message_t &&message) : EZMQByteData(NULL, 0)
+    {
+        // Small messages are stored inside message_t, so take data pointer after move
+        std::shared_ptr<zmq::message_t> owner = std::make_shared<zmq::message_t>(std::move(message));
+        mData = owner->data<uint8_t>();
+        mDataLength = owner->size();
+        mOwner = owner;
+    }
+
+    EZMQOwnedByteData::EZMQOwnedByteData(std::string &&data) : EZMQByteData(NULL, 0)
+    {
+        std::shared_ptr<std::string> owner = std::make_shared<std::string>(std::move(data));
+        mData = reinterpret_cast<const uint8_t *>(owner->data());
+        mDataLength = owner->size();
+        mOwner = owner;
+    }
+
+    EZMQOwnedByteData::EZMQOwnedByteData(const std::shared_ptr<const void> &owner,
+            const uint8_t *data, size_t dataLength) : EZMQByteData(data, dataLength), mOwner(owner)
+    {
+    }
+
+    EZMQOwnedByteData::EZMQOwnedByteData(EZMQOwnedByteData &&other) :
+        EZMQByteData(other), mOwner(std::move(other.mOwner))
+    {
+        other.reset();
+    }
+
+    EZMQOwnedByteData &EZMQOwnedByteData::operator=(EZMQOwnedByteData &&other)
+    {
+        if(this != &other)
+        {
+            EZMQByteData::operator=(other);
+            mOwner = std::move(other.mOwner);
+            other.reset();
+        }
+        return *this;
+    }
+
+    EZMQOwnedByteData::~EZMQOwnedByteData()
+    {
+    }
+
+    EZMQOwnedByteData EZMQOwnedByteData::share() const
+    {
+        EZMQOwnedByteData shared(mOwner, mData, mDataLength);
+        shared.mVersion = mVersion;
+        shared.mSchemaId = mSchemaId;
+        return shared;
+    }
+
+    EZMQErrorCode EZMQOwnedByteData::setByteData(const uint8_t * data, size_t dataLength)
+    {
+        VERIFY_NON_NULL(data)
+        if(dataLength == 0)
+        {
+            return EZMQ_ERROR;
+        }
+        std::shared_ptr<std::string> owner = std::make_shared<std::string>(
+            reinterpret_cast<const char *>(data), dataLength);
+        mData = reinterpret_cast<const uint8_t *>(owner->data());
+        mDataLength = dataLength;
+        mOwner = owner;
+        return EZMQ_OK;
+    }
+
+    void EZMQOwnedByteData::reset()
+    {
+        mData = NULL;
+        mDataLength = 0;
+        mOwner.reset();
+    }
+}
@@ -15,6 +15,12 @@
  *
  *******************************************************************************/
 
+#ifdef EZMQ_SCOPE_LOG_PUBLISHER
+#define EZMQ_SCOPE_LOG_MODULE 1
+#endif
+
+#include <chrono>
+#include <random>
 #include <regex>
 
 #if defined(_WIN32)
@@ -29,16 +35,21 @@
 #include "EZMQAPI.h"
 #include "EZMQPublisher.h"
 #include "EZMQLogger.h"
+#include "EZMQHeader.h"
+#include "EZMQTracer.h"
 #include "EZMQByteData.h"
+#include "EZMQJsonData.h"
+#include "EZMQEventBatch.h"
+#include "EZMQSegmentedByteData.h"
 #include "EZMQException.h"
 
 #define PUB_TCP_PREFIX "tcp://*:"
+#define INPROC_PREFIX "inproc://pub-shutdown-"
 #define TOPIC_PATTERN "[a-zA-Z0-9-_./]+"
-#define EZMQ_VERSION 1
-#define EZMQ_HEADER 0x00
-#define CONTENT_TYPE_OFFSET 5
-#define VERSION_OFFSET 2
 #define KEY_LENGTH 40
+#define SUBSCRIBE_FLAG 1
+#define SUBSCRIPTION_POLL_TIMEOUT 100
+#define MAX_SEQUENCE_TOPICS 1024
 #define TAG "EZMQPublisher"
 
 #ifdef __GNUC__
@@ -47,18 +58,39 @@
 
 namespace ezmq
 {
+    // Releases owner of a segment once zmq has sent it
+    static void releaseSegment(void * /*data*/, void *hint)
+    {
+        delete static_cast<std::shared_ptr<const void> *>(hint);
+    }
+
     EZMQPublisher::EZMQPublisher(const int &port, EZMQStartCB startCB, EZMQStopCB stopCB, EZMQErrorCB errorCB):
-        mPort(port), mStartCallback(startCB), mStopCallback(stopCB), mErrorCallback(errorCB)
+        mPort(port), mStartCallback(startCB), mStopCallback(stopCB), mErrorCallback(errorCB),
+        mMetrics("pub:" + std::to_string(port))
     {
         mContext = EZMQAPI::getInstance()->getContext();
         if(nullptr == mContext)
         {
              EZMQ_LOG(ERROR, TAG, "Context is null");
         }
+        mPubCallback = NULL;
         mPublisher = nullptr;
+        mShutdownServer = nullptr;
+        mShutdownClient = nullptr;
+        isReceiverStarted = false;
+        mLastValueCacheEnabled = false;
+        mSkipUnwatchedTopics = false;
+        mCompressionCodec = EZMQ_COMPRESSION_NONE;
+        mCompressionLevel = 0;
+        mCompressionThreshold = 0;
+        mSequenceEnabled = false;
+        mPublisherId = 0;
+        mTimestampEnabled = false;
+        mSocketMonitorEnabled = false;
     }
 
-    EZMQPublisher::EZMQPublisher(const int &port, EZMQPUBCallback *callback): mPort(port), mPubCallback(callback)
+    EZMQPublisher::EZMQPublisher(const int &port, EZMQPUBCallback *callback): mPort(port), mPubCallback(callback),
+        mMetrics("pub:" + std::to_string(port))
     {
         mContext = EZMQAPI::getInstance()->getContext();
         if(nullptr == mContext)
@@ -66,6 +98,18 @@ namespace ezmq
              EZMQ_LOG(ERROR, TAG, "Context is null");
         }
         mPublisher = nullptr;
+        mShutdownServer = nullptr;
+        mShutdownClient = nullptr;
+        isReceiverStarted = false;
+        mLastValueCacheEnabled = false;
+        mSkipUnwatchedTopics = false;
+        mCompressionCodec = EZMQ_COMPRESSION_NONE;
+        mCompressionLevel = 0;
+        mCompressionThreshold = 0;
+        mSequenceEnabled = false;
+        mPublisherId = 0;
+        mTimestampEnabled = false;
+        mSocketMonitorEnabled = false;
     }
 
     EZMQPublisher::~EZMQPublisher()
@@ -95,6 +139,152 @@ namespace ezmq
         return EZMQ_OK;
     }
 
+    EZMQErrorCode EZMQPublisher::setLastValueCache(bool enable)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mLastValueCacheEnabled = enable;
+        if(!enable)
+        {
+            mLastValueCache.clear();
+        }
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQPublisher::setCompression(EZMQCompressionCodec codec, int level,
+        size_t threshold)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        if(!EZMQCompression::isSupported(codec))
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Not a supported codec: %d", codec);
+            return EZMQ_ERROR;
+        }
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mCompressionCodec = codec;
+        mCompressionLevel = level;
+        mCompressionThreshold = threshold;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQPublisher::setCompressionDictionary(
+        std::shared_ptr<EZMQCompressionDictionary> dictionary)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        if(nullptr == dictionary || 0 == dictionary->getId())
+        {
+            EZMQ_LOG(ERROR, TAG, "Invalid dictionary");
+            return EZMQ_ERROR;
+        }
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mCompressionDictionary = dictionary;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQPublisher::setSequenceNumbers(bool enable)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mSequenceEnabled = enable;
+        mSequences.clear();
+        if(enable)
+        {
+            // Distinguishes sequences of this publisher instance from others and restarts
+            std::random_device random;
+            mPublisherId = random();
+        }
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQPublisher::setPublishTimestamps(bool enable)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mTimestampEnabled = enable;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQPublisher::setSocketMonitor(bool enable, EZMQSocketEventCB callback)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mSocketMonitorEnabled = enable;
+        mSocketEventCallback = callback;
+        if(!mSocketEventCallback && mPubCallback)
+        {
+            mSocketEventCallback = [this](EZMQSocketEvent event, const std::string &address)
+            {
+                mPubCallback->onSocketEventCB(event, address);
+            };
+        }
+        return EZMQ_OK;
+    }
+
+    uint64_t EZMQPublisher::getSocketEventCount(EZMQSocketEvent event)
+    {
+        return mSocketMonitor.getEventCount(event);
+    }
+
+    EZMQErrorCode EZMQPublisher::setSkipUnwatchedTopics(bool enable)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(mPublisher)
+        {
+            EZMQ_LOG(ERROR, TAG, "Publisher is already started");
+            return EZMQ_ERROR;
+        }
+        mSkipUnwatchedTopics = enable;
+        return EZMQ_OK;
+    }
+
+    bool EZMQPublisher::hasSubscribers(std::string topic)
+    {
+        if(!isSubscriptionAware())
+        {
+            return true;
+        }
+        if(!topic.empty())
+        {
+            topic = sanitizeTopic(topic);
+            if(topic.empty())
+            {
+                return false;
+            }
+        }
+        return isWatched(topic);
+    }
+
     EZMQErrorCode EZMQPublisher::start()
     {
         EZMQ_SCOPE_LOGGER(TAG, __func__);
@@ -104,8 +294,19 @@ namespace ezmq
             if(nullptr == mPublisher)
             {
                 VERIFY_NON_NULL(mContext)
-                mPublisher = new(std::nothrow) zmq::socket_t(*mContext, ZMQ_PUB);
-                ALLOC_ASSERT(mPublisher)
+                if(isSubscriptionAware())
+                {
+                    // XPUB delivers subscription messages of subscribers to publisher
+                    mPublisher = new(std::nothrow) zmq::socket_t(*mContext, ZMQ_XPUB);
+                    ALLOC_ASSERT(mPublisher)
+                    int verbose = 1;
+                    mPublisher->setsockopt(ZMQ_XPUB_VERBOSE, &verbose, sizeof(verbose));
+                }
+                else
+                {
+                    mPublisher = new(std::nothrow) zmq::socket_t(*mContext, ZMQ_PUB);
+                    ALLOC_ASSERT(mPublisher)
+                }
 #ifdef SECURITY_ENABLED
                 if (mServerSecretKey.length() == KEY_LENGTH)
                 {
@@ -121,12 +322,24 @@ namespace ezmq
                     mServerSecretKey = "";
                 }
 #endif // SECURITY_ENABLED
+                // Monitor before bind, so listening event is not missed
+                if(mSocketMonitorEnabled && EZMQ_OK != mSocketMonitor.start(*mPublisher,
+                    mSocketEventCallback))
+                {
+                    EZMQ_LOG(ERROR, TAG, "Failed to start socket monitor");
+                }
                 mPublisher->bind(getSocketAddress());
+                if(isSubscriptionAware())
+                {
+                    startReceiver();
+                }
             }
         }
         catch (std::exception &e)
         {
             EZMQ_LOG_V(ERROR, TAG, "[start] caught exception %s", e.what());
+            stopReceiver();
+            mSocketMonitor.stop();
             delete mPublisher;
             mPublisher = nullptr;
             return EZMQ_ERROR;
@@ -137,12 +350,10 @@ namespace ezmq
 
     EZMQErrorCode EZMQPublisher::publishInternal(std::string &topic, const EZMQMessage &event)
     {
+        EZMQ_TRACE_SCOPE(publishTrace, "publish");
         // Form EZMQ header
-        unsigned char ezmqHeader = EZMQ_HEADER;
-        unsigned char version = EZMQ_VERSION ;
-        version = version << VERSION_OFFSET;
-        ezmqHeader =  ezmqHeader | version;
-        unsigned char contentType;
+        EZMQHeader ezmqHeader;
+        int contentType;
         if(EZMQ_CONTENT_TYPE_PROTOBUF == event.getContentType())
         {
             contentType = EZMQ_CONTENT_TYPE_PROTOBUF;
@@ -151,27 +362,64 @@ namespace ezmq
         {
             contentType = EZMQ_CONTENT_TYPE_BYTEDATA;
         }
+        else if(EZMQ_CONTENT_TYPE_JSON == event.getContentType())
+        {
+            contentType = EZMQ_CONTENT_TYPE_JSON;
+        }
+        else if(EZMQ_CONTENT_TYPE_EVENT_BATCH == event.getContentType())
+        {
+            contentType = EZMQ_CONTENT_TYPE_EVENT_BATCH;
+        }
+        else if(EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA == event.getContentType())
+        {
+            contentType = EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA;
+        }
         else
         {
             EZMQ_LOG(ERROR, TAG, "Not a supported content-type");
             return EZMQ_INVALID_CONTENT_TYPE;
         }
-        contentType = contentType << CONTENT_TYPE_OFFSET;
-        ezmqHeader =  ezmqHeader | contentType;
+        ezmqHeader.setContentType(contentType);
+        if(0 != event.getSchemaId())
+        {
+            ezmqHeader.setSchemaId(event.getSchemaId());
+        }
+
+        // No need to serialize event which is not subscribed by anyone
+        if(mSkipUnwatchedTopics && !mLastValueCacheEnabled && !isWatched(topic))
+        {
+            EZMQ_HOT_LOG(DEBUG, TAG, "No subscriber for topic, skipped");
+            return EZMQ_OK;
+        }
+
+        // Segmented byte data has variable number of frames, so its topic frame is sent
+        // even without topic, as empty frame. Subscriber takes first of 3+ frames as topic.
+        bool hasTopicFrame = !topic.empty() || EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA == contentType;
+
+        // Count under topic without trailing '/', as the subscriber does
+        std::string metricsTopic = topic;
+        if (!metricsTopic.empty() && '/' == metricsTopic[metricsTopic.length() - 1])
+        {
+            metricsTopic.erase(metricsTopic.length() - 1);
+        }
 
         zmq::multipart_t zmqMultipart;
         try
         {
+            EZMQMetrics::ScopeTimer timer(mMetrics, metricsTopic, EZMQ_METRIC_SERIALIZATION_TIME);
+            EZMQ_TRACE_SCOPE(serializeTrace, "serialize");
+
             // EZMQ Topic [ZMQMessage]
-            if(!(topic.empty()))
+            if(hasTopicFrame)
             {
                 zmqMultipart.addstr(topic);
             }
 
-            //EZMQ header [ZMQMessage]
-            zmqMultipart.add(zmq::message_t((void *)(&ezmqHeader), sizeof(ezmqHeader)));
-
-            //EZMQ Data [ZMQMessage]
+            //EZMQ Data
+            std::string eventStr;
+            const void *data = NULL;
+            size_t size = 0;
+            const EZMQSegmentedByteData *segmentedData = NULL;
             if(EZMQ_CONTENT_TYPE_PROTOBUF == event.getContentType())
             {
                 const Event *protoEvent =  dynamic_cast<const Event*>(&event);
@@ -180,13 +428,13 @@ namespace ezmq
                     EZMQ_LOG(ERROR, TAG, "[protoEvent] dynamic_cast failed");
                     return EZMQ_ERROR;
                 }
-                std::string eventStr;
                 bool result = protoEvent->SerializeToString(&eventStr);
                 if (false == result)
                 {
                     return EZMQ_ERROR;
                 }
-                zmqMultipart.add(zmq::message_t(eventStr.c_str(), eventStr.size()));
+                data = eventStr.c_str();
+                size = eventStr.size();
             }
             else if(EZMQ_CONTENT_TYPE_BYTEDATA == event.getContentType())
             {
@@ -201,7 +449,126 @@ namespace ezmq
                     EZMQ_LOG(ERROR, TAG, "[ByteData] Byte Data is NULL");
                     return EZMQ_ERROR;
                 }
-                zmqMultipart.add(zmq::message_t(byteData->getByteData(), byteData->getLength()));
+                data = byteData->getByteData();
+                size = byteData->getLength();
+            }
+            else if(EZMQ_CONTENT_TYPE_JSON == event.getContentType())
+            {
+                const EZMQJsonData *jsonData =  dynamic_cast<const EZMQJsonData*>(&event);
+                if(NULL == jsonData)
+                {
+                    EZMQ_LOG(ERROR, TAG, "[JsonData] dynamic_cast failed");
+                    return EZMQ_ERROR;
+                }
+                if(jsonData->getJson().empty())
+                {
+                    EZMQ_LOG(ERROR, TAG, "[JsonData] JSON is empty");
+                    return EZMQ_ERROR;
+                }
+                data = jsonData->getJson().c_str();
+                size = jsonData->getJson().size();
+            }
+            else if(EZMQ_CONTENT_TYPE_EVENT_BATCH == event.getContentType())
+            {
+                const EZMQEventBatch *eventBatch =  dynamic_cast<const EZMQEventBatch*>(&event);
+                if(NULL == eventBatch)
+                {
+                    EZMQ_LOG(ERROR, TAG, "[EventBatch] dynamic_cast failed");
+                    return EZMQ_ERROR;
+                }
+                if(eventBatch->getData().empty())
+                {
+                    EZMQ_LOG(ERROR, TAG, "[EventBatch] Event is not set");
+                    return EZMQ_ERROR;
+                }
+                data = eventBatch->getData().c_str();
+                size = eventBatch->getData().size();
+            }
+            else if(EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA == event.getContentType())
+            {
+                segmentedData =  dynamic_cast<const EZMQSegmentedByteData*>(&event);
+                if(NULL == segmentedData)
+                {
+                    EZMQ_LOG(ERROR, TAG, "[SegmentedByteData] dynamic_cast failed");
+                    return EZMQ_ERROR;
+                }
+                if(0 == segmentedData->getSegmentCount())
+                {
+                    EZMQ_LOG(ERROR, TAG, "[SegmentedByteData] No segment");
+                    return EZMQ_ERROR;
+                }
+            }
+
+            EZMQ_TRACE_END(serializeTrace);
+
+            //Compress data as per compression policy, send as is if it does not shrink
+            //Segments are always sent as is
+            EZMQ_TRACE_SCOPE(compressTrace, "compress");
+            std::string compressed;
+            EZMQErrorCode result = EZMQ_ERROR;
+            bool toCompress = NULL == segmentedData && EZMQ_COMPRESSION_NONE != mCompressionCodec &&
+                size >= mCompressionThreshold;
+            if(toCompress && EZMQ_COMPRESSION_ZSTD_DICT == mCompressionCodec)
+            {
+                if(mCompressionDictionary)
+                {
+                    result = EZMQCompression::compress(*mCompressionDictionary, data, size, compressed);
+                }
+            }
+            else if(toCompress)
+            {
+                result = EZMQCompression::compress(mCompressionCodec, mCompressionLevel, data, size,
+                    compressed);
+            }
+            if(EZMQ_OK == result && compressed.size() < size)
+            {
+                ezmqHeader.setCompressionCodec(mCompressionCodec);
+                data = compressed.c_str();
+                size = compressed.size();
+            }
+
+            EZMQ_TRACE_END(compressTrace);
+
+            //EZMQ header [ZMQMessage], sequence number and timestamp are written while sending
+            EZMQ_TRACE_SCOPE(headerTrace, "header");
+            if(mSequenceEnabled)
+            {
+                ezmqHeader.setSequence(mPublisherId, 0);
+            }
+            if(mTimestampEnabled)
+            {
+                ezmqHeader.setTimestamp(0);
+            }
+            zmq::message_t headerFrame(ezmqHeader.getSize());
+            ezmqHeader.write(headerFrame.data<unsigned char>());
+            zmqMultipart.add(std::move(headerFrame));
+            EZMQ_TRACE_END(headerTrace);
+
+            if(segmentedData)
+            {
+                //EZMQ Data segments [ZMQMessage], owned segments are sent without copy
+                for (const auto &segment : segmentedData->mSegments)
+                {
+                    if(segment.mOwner)
+                    {
+                        // Frame owns the hint only once it is constructed
+                        std::unique_ptr<std::shared_ptr<const void>> owner(
+                            new std::shared_ptr<const void>(segment.mOwner));
+                        zmq::message_t frame((void *)segment.getByteData(), segment.getLength(),
+                            releaseSegment, owner.get());
+                        owner.release();
+                        zmqMultipart.add(std::move(frame));
+                    }
+                    else
+                    {
+                        zmqMultipart.add(zmq::message_t(segment.getByteData(), segment.getLength()));
+                    }
+                }
+            }
+            else
+            {
+                //EZMQ Data [ZMQMessage]
+                zmqMultipart.add(zmq::message_t(data, size));
             }
         }
         catch(std::exception &e)
@@ -210,25 +577,74 @@ namespace ezmq
             return EZMQ_ERROR;
         }
 
-        //send data [ZMQMessage] on socket
+        //send data [ZMQMessage] on socket, waiting for lock is part of it
+        EZMQ_TRACE_SCOPE(sendTrace, "send");
         std::lock_guard<std::recursive_mutex> lock(mPubLock);
         bool result = false;
+        size_t bytes = 0;
         try
         {
             VERIFY_NON_NULL(mPublisher)
+            size_t headerIndex = hasTopicFrame ? 1 : 0;
+            unsigned char *header = zmqMultipart.at(headerIndex).data<unsigned char>();
+            if(mSequenceEnabled)
+            {
+                // Sequence is assigned under lock, so it increases in order of sending
+                auto it = mSequences.find(topic);
+                if(it == mSequences.end())
+                {
+                    if(mSequences.size() >= MAX_SEQUENCE_TOPICS)
+                    {
+                        // Subscribers track [publisher ID, topic], with a new ID restarted
+                        // sequences are tracked anew instead of taken as duplicates
+                        mSequences.clear();
+                        std::random_device random;
+                        mPublisherId = random();
+                        EZMQ_LOG(DEBUG, TAG, "Sequence topics limit reached, publisher ID renewed");
+                    }
+                    it = mSequences.insert(std::make_pair(topic, 0)).first;
+                }
+                ezmqHeader.setSequence(mPublisherId, ++it->second);
+                ezmqHeader.write(header);
+            }
+            if(mLastValueCacheEnabled)
+            {
+                // Keep all frames for late joining subscribers
+                std::vector<std::string> &lastValue = mLastValueCache[topic];
+                lastValue.clear();
+                for (size_t i = 0; i < zmqMultipart.size(); i++)
+                {
+                    lastValue.push_back(zmqMultipart.peekstr(i));
+                }
+            }
+            if(mTimestampEnabled)
+            {
+                // Cached last value keeps zero timestamp, its resend is not a latency sample
+                uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+                ezmqHeader.setTimestamp(now);
+                ezmqHeader.write(header);
+            }
+            for (size_t i = 0; i < zmqMultipart.size(); i++)
+            {
+                bytes += zmqMultipart.at(i).size();
+            }
             result = zmqMultipart.send(*mPublisher);
         }
         catch(std::exception &e)
         {
             EZMQ_LOG_V(ERROR, TAG, "[publish] caught exception %s", e.what());
+            mMetrics.add(metricsTopic, EZMQ_METRIC_SEND_FAILURES, 1);
             return EZMQ_ERROR;
         }
         if (false == result)
         {
             EZMQ_LOG(ERROR, TAG, "Publish failed");
+            mMetrics.add(metricsTopic, EZMQ_METRIC_SEND_FAILURES, 1);
             return EZMQ_ERROR;
         }
-        EZMQ_LOG(DEBUG, TAG, "Published data");
+        mMetrics.add(metricsTopic, {{EZMQ_METRIC_MESSAGES_SENT, 1}, {EZMQ_METRIC_BYTES_SENT, bytes}});
+        EZMQ_HOT_LOG(DEBUG, TAG, "Published data");
         return EZMQ_OK;
     }
 
@@ -275,7 +691,18 @@ namespace ezmq
     {
         EZMQ_SCOPE_LOGGER(TAG, __func__);
         EZMQErrorCode result = EZMQ_ERROR;
+
+        // Receiver thread takes the lock, so stop it before locking
+        stopReceiver();
         std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        mLastValueCache.clear();
+        {
+            std::lock_guard<std::mutex> subscriptionLock(mSubscriptionLock);
+            mSubscriptions.clear();
+        }
+
+        // Socket can have one monitor, stop this one before sync close monitors it
+        mSocketMonitor.stop();
 
         // Sync close
         result = syncClose();
@@ -298,6 +725,11 @@ namespace ezmq
         return mPort;
     }
 
+    EZMQMetrics &EZMQPublisher::getMetrics()
+    {
+        return mMetrics;
+    }
+
     std::string EZMQPublisher::getSocketAddress()
     {
         try
@@ -311,6 +743,13 @@ namespace ezmq
         return "";
     }
 
+    std::string EZMQPublisher::getInProcUniqueAddress()
+    {
+        std::string address = INPROC_PREFIX + std::to_string(std::rand());
+        EZMQ_LOG_V(DEBUG, TAG, "The in proc address is:: %s", address.c_str());
+        return address;
+    }
+
     std::string EZMQPublisher::sanitizeTopic(std::string &topic)
     {
         if(topic.empty())
@@ -341,6 +780,202 @@ namespace ezmq
         return topic;
     }
 
+    bool EZMQPublisher::isSubscriptionAware()
+    {
+        return mLastValueCacheEnabled || mSkipUnwatchedTopics;
+    }
+
+    bool EZMQPublisher::isWatched(const std::string &topic)
+    {
+        // Subscription matches if it is a prefix of the topic. Events without topic start
+        // with EZMQ header which is not a valid topic character, so only subscriptions
+        // for all events [empty prefix] match those.
+        std::lock_guard<std::mutex> lock(mSubscriptionLock);
+        return mSubscriptions.hasPrefixOf(topic);
+    }
+
+    EZMQErrorCode EZMQPublisher::startReceiver()
+    {
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        VERIFY_NON_NULL(mContext)
+        VERIFY_NON_NULL(mPublisher)
+        std::string address = getInProcUniqueAddress();
+        // Shutdown server sockets
+        if (!mShutdownServer)
+        {
+            mShutdownServer = new(std::nothrow) zmq::socket_t(*mContext, ZMQ_PAIR);
+            ALLOC_ASSERT(mShutdownServer)
+            mShutdownServer->bind(address);
+        }
+
+        // Shutdown client sockets
+        if (!mShutdownClient)
+        {
+            mShutdownClient = new(std::nothrow) zmq::socket_t(*mContext, ZMQ_PAIR);
+            ALLOC_ASSERT(mShutdownClient)
+            mShutdownClient->connect(address);
+            zmq_pollitem_t shutDownPoller;
+            shutDownPoller.socket = *mShutdownClient;
+            shutDownPoller.events = ZMQ_POLLIN;
+            mPollItems.push_back(shutDownPoller);
+        }
+
+        // Publisher socket is used by publishing threads as well, so receiver thread
+        // only polls on its file descriptor and reads subscriptions under the lock.
+        zmq_pollitem_t subscriptionPoller;
+        size_t fdSize = sizeof(subscriptionPoller.fd);
+        mPublisher->getsockopt(ZMQ_FD, &subscriptionPoller.fd, &fdSize);
+        subscriptionPoller.socket = NULL;
+        subscriptionPoller.events = ZMQ_POLLIN;
+        mPollItems.push_back(subscriptionPoller);
+
+        //receiver Thread
+        if(!isReceiverStarted)
+        {
+            isReceiverStarted = true;
+            mThread = std::thread(&EZMQPublisher::receive, this);
+        }
+        return EZMQ_OK;
+    }
+
+    void EZMQPublisher::stopReceiver()
+    {
+        try
+        {
+            // Send a shutdown message to receiver thread
+            if (mShutdownServer && isReceiverStarted)
+            {
+                std::string msg = "shutdown";
+                zmq::message_t zMsg (msg.size());
+                memcpy ((void *) zMsg.data (), msg.c_str(), msg.size());
+                bool result =  mShutdownServer->send(zMsg);
+                UNUSED(result);
+                EZMQ_LOG_V(DEBUG, TAG, "Shut down request sent[Result]: %d", result);
+            }
+
+            //wait for shutdown msg to be sent to receiver thread
+            if(isReceiverStarted)
+            {
+                mThread.join();
+            }
+
+            // close shut down client socket
+            if (mShutdownClient)
+            {
+                mShutdownClient->close();
+                delete mShutdownClient;
+                mShutdownClient = nullptr;
+            }
+
+            // close shut down server socket
+            if (mShutdownServer)
+            {
+                mShutdownServer->close();
+                delete mShutdownServer;
+                mShutdownServer = nullptr;
+            }
+        }
+        catch(std::exception &e)
+        {
+            EZMQ_LOG_V(ERROR, TAG, "caught exception: %s", e.what());
+        }
+        mPollItems.clear();
+        isReceiverStarted = false;
+    }
+
+    void EZMQPublisher::receive()
+    {
+        while(isReceiverStarted)
+        {
+            try
+            {
+                // ZMQ_FD is edge triggered and publishing threads may consume its
+                // notification, so poll with timeout to bound the delay.
+                zmq::poll(mPollItems, SUBSCRIPTION_POLL_TIMEOUT);
+            }
+            catch (std::exception &e)
+            {
+                EZMQ_LOG_V(ERROR, TAG, "[receive] caught exception: %s", e.what());
+                return;
+            }
+            if(mPollItems[0].revents & ZMQ_POLLIN)
+            {
+                EZMQ_LOG(DEBUG, TAG, "[receive] Shut down request");
+                break;
+            }
+            handleSubscriptions();
+        }
+    }
+
+    void EZMQPublisher::handleSubscriptions()
+    {
+        std::lock_guard<std::recursive_mutex> lock(mPubLock);
+        if(nullptr == mPublisher)
+        {
+            return;
+        }
+        try
+        {
+            // Subscription message: [subscribe(1)/unsubscribe(0)][topic prefix]
+            zmq::message_t subscription;
+            while(mPublisher->recv(&subscription, ZMQ_DONTWAIT))
+            {
+                if(subscription.size() < 1)
+                {
+                    continue;
+                }
+                const char *data = static_cast<const char *>(subscription.data());
+                std::string prefix(data + 1, subscription.size() - 1);
+                EZMQ_LOG_V(DEBUG, TAG, "Subscription [%d]: %s", data[0], prefix.c_str());
+                if(SUBSCRIBE_FLAG == data[0])
+                {
+                    {
+                        std::lock_guard<std::mutex> subscriptionLock(mSubscriptionLock);
+                        mSubscriptions.insert(prefix, nullptr);
+                    }
+                    if(mLastValueCacheEnabled)
+                    {
+                        sendLastValues(prefix);
+                    }
+                }
+                else
+                {
+                    // XPUB reports unsubscription only when last subscriber of prefix leaves
+                    std::lock_guard<std::mutex> subscriptionLock(mSubscriptionLock);
+                    mSubscriptions.erase(prefix);
+                }
+            }
+        }
+        catch(std::exception &e)
+        {
+            EZMQ_LOG_V(ERROR, TAG, "[subscription] caught exception %s", e.what());
+        }
+    }
+
+    void EZMQPublisher::sendLastValues(const std::string &prefix)
+    {
+        // Cache is sorted, so all topics matching the prefix are contiguous
+        auto it = mLastValueCache.lower_bound(prefix);
+        for (; it != mLastValueCache.end(); ++it)
+        {
+            if(0 != it->first.compare(0, prefix.size(), prefix))
+            {
+                break;
+            }
+            zmq::multipart_t zmqMultipart;
+            for (const auto &frame : it->second)
+            {
+                zmqMultipart.addstr(frame);
+            }
+            if(false == zmqMultipart.send(*mPublisher))
+            {
+                EZMQ_LOG(ERROR, TAG, "Last value publish failed");
+                return;
+            }
+            EZMQ_LOG_V(DEBUG, TAG, "Published last value [Topic]: %s", it->first.c_str());
+        }
+    }
+
     std::string getMonitorAddress()
     {
         std::string MONITOR_PREFIX = "inproc://monitor-";
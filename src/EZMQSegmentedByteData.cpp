@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQSegmentedByteData.h"
+#include "EZMQLogger.h"
+
+#define TAG "EZMQSegmentedByteData"
+
+namespace ezmq
+{
+    EZMQSegmentedByteData::EZMQSegmentedByteData()
+    {
+        mContentType = EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA;
+    }
+
+    EZMQSegmentedByteData::~EZMQSegmentedByteData()
+    {
+    }
+
+    EZMQErrorCode EZMQSegmentedByteData::addSegment(const uint8_t *data, size_t dataLength)
+    {
+        VERIFY_NON_NULL(data)
+        if(dataLength == 0)
+        {
+            return EZMQ_ERROR;
+        }
+        mSegments.push_back(EZMQOwnedByteData(std::shared_ptr<const void>(), data, dataLength));
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQSegmentedByteData::addSegment(EZMQOwnedByteData &&segment)
+    {
+        if(NULL == segment.getByteData() || 0 == segment.getLength())
+        {
+            EZMQ_LOG(ERROR, TAG, "Segment is empty");
+            return EZMQ_ERROR;
+        }
+        mSegments.push_back(std::move(segment));
+        return EZMQ_OK;
+    }
+
+    size_t EZMQSegmentedByteData::getSegmentCount() const
+    {
+        return mSegments.size();
+    }
+
+    const EZMQOwnedByteData &EZMQSegmentedByteData::getSegment(size_t index) const
+    {
+        return mSegments.at(index);
+    }
+
+    size_t EZMQSegmentedByteData::getLength() const
+    {
+        size_t length = 0;
+        for (const auto &segment : mSegments)
+        {
+            length += segment.getLength();
+        }
+        return length;
+    }
+
+    void EZMQSegmentedByteData::clear()
+    {
+        mSegments.clear();
+    }
+}
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQSocketMonitor.h"
+#include "EZMQLogger.h"
+
+#define MONITOR_PREFIX "inproc://socket-monitor-"
+#define POLL_TIMEOUT 100
+#define TAG "EZMQSocketMonitor"
+
+// Handshake events are draft API of libzmq 4.2, stable since 4.3
+#define HANDSHAKE_FAILED_NO_DETAIL 0x0800
+#define HANDSHAKE_SUCCEEDED 0x1000
+#define HANDSHAKE_FAILED_PROTOCOL 0x2000
+#define HANDSHAKE_FAILED_AUTH 0x4000
+
+namespace ezmq
+{
+    class EZMQSocketMonitor::Monitor : public zmq::monitor_t
+    {
+        public:
+            Monitor(EZMQSocketMonitor &owner) : mOwner(owner)
+            {
+            }
+
+        private:
+            EZMQSocketMonitor &mOwner;
+
+            void on_event_connected(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_CONNECTED, address);
+            }
+
+            void on_event_connect_delayed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_CONNECT_DELAYED, address);
+            }
+
+            void on_event_connect_retried(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_CONNECT_RETRIED, address);
+            }
+
+            void on_event_listening(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_LISTENING, address);
+            }
+
+            void on_event_bind_failed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_BIND_FAILED, address);
+            }
+
+            void on_event_accepted(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_ACCEPTED, address);
+            }
+
+            void on_event_accept_failed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_ACCEPT_FAILED, address);
+            }
+
+            void on_event_closed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_CLOSED, address);
+            }
+
+            void on_event_close_failed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_CLOSE_FAILED, address);
+            }
+
+            void on_event_disconnected(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_DISCONNECTED, address);
+            }
+
+            void on_event_handshake_failed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_HANDSHAKE_FAILED, address);
+            }
+
+            void on_event_handshake_succeed(const zmq_event_t &, const char *address)
+            {
+                mOwner.onEvent(EZMQ_SOCKET_EVENT_HANDSHAKE_SUCCEEDED, address);
+            }
+
+            // cppzmq dispatches handshake events only when built with draft API
+            void on_event_unknown(const zmq_event_t &event, const char *address)
+            {
+                if(HANDSHAKE_SUCCEEDED == event.event)
+                {
+                    mOwner.onEvent(EZMQ_SOCKET_EVENT_HANDSHAKE_SUCCEEDED, address);
+                }
+                else if(HANDSHAKE_FAILED_NO_DETAIL == event.event ||
+                    HANDSHAKE_FAILED_PROTOCOL == event.event || HANDSHAKE_FAILED_AUTH == event.event)
+                {
+                    mOwner.onEvent(EZMQ_SOCKET_EVENT_HANDSHAKE_FAILED, address);
+                }
+            }
+    };
+
+    EZMQSocketMonitor::EZMQSocketMonitor()
+    {
+        mRunning = false;
+        for (auto &count : mCounts)
+        {
+            count = 0;
+        }
+    }
+
+    EZMQSocketMonitor::~EZMQSocketMonitor()
+    {
+        stop();
+    }
+
+    EZMQErrorCode EZMQSocketMonitor::start(zmq::socket_t &socket, EZMQSocketEventCB callback)
+    {
+        if(mMonitor)
+        {
+            EZMQ_LOG(ERROR, TAG, "Monitor is already started");
+            return EZMQ_ERROR;
+        }
+        mCallback = callback;
+        std::unique_ptr<Monitor> monitor(new Monitor(*this));
+        try
+        {
+            // Address is unique per monitor instance
+            std::string address = MONITOR_PREFIX + std::to_string((uintptr_t)this);
+            monitor->init(socket, address, ZMQ_EVENT_ALL);
+        }
+        catch(std::exception &e)
+        {
+            EZMQ_LOG_V(ERROR, TAG, "caught exception while starting monitor: %s", e.what());
+            return EZMQ_ERROR;
+        }
+        mMonitor = std::move(monitor);
+        mRunning = true;
+        mThread = std::thread(&EZMQSocketMonitor::run, this);
+        return EZMQ_OK;
+    }
+
+    void EZMQSocketMonitor::stop()
+    {
+        if(!mMonitor)
+        {
+            return;
+        }
+        mRunning = false;
+        mThread.join();
+        // Detaches monitor from socket and closes monitor socket
+        mMonitor.reset();
+    }
+
+    void EZMQSocketMonitor::run()
+    {
+        while(mRunning)
+        {
+            try
+            {
+                mMonitor->check_event(POLL_TIMEOUT);
+            }
+            catch(std::exception &e)
+            {
+                EZMQ_LOG_V(ERROR, TAG, "caught exception while checking event: %s", e.what());
+                return;
+            }
+        }
+    }
+
+    void EZMQSocketMonitor::onEvent(EZMQSocketEvent event, const char *address)
+    {
+        mCounts[event]++;
+        EZMQ_LOG_V(DEBUG, TAG, "Socket event: %d [Address]: %s", event, address);
+        if(mCallback)
+        {
+            mCallback(event, address);
+        }
+    }
+
+    uint64_t EZMQSocketMonitor::getEventCount(EZMQSocketEvent event) const
+    {
+        if(event < 0 || event >= EZMQ_SOCKET_EVENT_COUNT)
+        {
+            return 0;
+        }
+        return mCounts[event];
+    }
+}
@@ -15,21 +15,34 @@
  *
  *******************************************************************************/
 
+#ifdef EZMQ_SCOPE_LOG_SUBSCRIBER
+#define EZMQ_SCOPE_LOG_MODULE 1
+#endif
+
+#include <algorithm>
+#include <chrono>
 #include <regex>
 
 #include "EZMQAPI.h"
 #include "EZMQSubscriber.h"
 #include "EZMQLogger.h"
+#include "EZMQHeader.h"
+#include "EZMQTracer.h"
 #include "EZMQByteData.h"
+#include "EZMQOwnedByteData.h"
+#include "EZMQSegmentedByteData.h"
+#include "EZMQJsonData.h"
+#include "EZMQEventBatch.h"
 #include "EZMQException.h"
 
 #define TCP_PREFIX "tcp://"
 #define INPROC_PREFIX "inproc://shutdown-"
-#define TOPIC_PATTERN "[a-zA-Z0-9-_./]+"
-#define CONTENT_TYPE_OFFSET 5
-#define VERSION_OFFSET 2
-#define VERSION_MASK 0x07
+#define TOPIC_PATTERN "[a-zA-Z0-9-_./+#]+"
 #define KEY_LENGTH 40
+#define MAX_FRAME_COUNT 1024
+#define MAX_TRACKED_SEQUENCES 1024
+#define MAX_LATENCY_TOPICS 64
+#define MAX_DROPPED_TOPICS 64
 #define TAG "EZMQSubscriber"
 
 #ifdef __GNUC__
@@ -38,8 +51,24 @@
 
 namespace ezmq
 {
+    namespace
+    {
+        struct HandlerContext
+        {
+            const std::string *topic;
+            const EZMQMessage *event;
+        };
+
+        void invokeHandler(const EZMQSubTopicCB &handler, void *context)
+        {
+            HandlerContext *handlerContext = static_cast<HandlerContext *>(context);
+            handler(*(handlerContext->topic), *(handlerContext->event));
+        }
+    }
+
     EZMQSubscriber::EZMQSubscriber(const std::string &ip, const int &port, EZMQSubCB subCallback, EZMQSubTopicCB topicCallback):
-        mIp(ip), mPort(port), mSubCallback(subCallback), mSubTopicCallback(topicCallback)
+        mIp(ip), mPort(port), mSubCallback(subCallback), mSubTopicCallback(topicCallback),
+        mMetrics("sub:" + ip + ":" + std::to_string(port))
     {
         mContext = EZMQAPI::getInstance()->getContext();
         if(nullptr == mContext)
@@ -50,11 +79,16 @@ namespace ezmq
         mShutdownClient = nullptr;
         mSubscriber = nullptr;
         isReceiverStarted = false;
+        mRejectedCount = 0;
+        mSocketMonitorEnabled = false;
+        mDispatching = false;
+        mTrackedCount = 0;
+        mDroppedCount = 0;
         mCallback= NULL;
     }
 
     EZMQSubscriber::EZMQSubscriber(const std::string &ip, const int &port, EZMQSUBCallback *callback):
-        mIp(ip), mPort(port), mCallback(callback)
+        mIp(ip), mPort(port), mCallback(callback), mMetrics("sub:" + ip + ":" + std::to_string(port))
     {
         mContext = EZMQAPI::getInstance()->getContext();
         if(nullptr == mContext)
@@ -65,6 +99,11 @@ namespace ezmq
         mShutdownClient = nullptr;
         mSubscriber = nullptr;
         isReceiverStarted = false;
+        mRejectedCount = 0;
+        mSocketMonitorEnabled = false;
+        mDispatching = false;
+        mTrackedCount = 0;
+        mDroppedCount = 0;
     }
 
     EZMQSubscriber::~EZMQSubscriber()
@@ -77,18 +116,22 @@ namespace ezmq
         zmq::message_t zFrame1;
         zmq::message_t zFrame2;
         zmq::message_t zFrame3;
+        std::vector<zmq::message_t> segmentFrames;
+        zmq::message_t *headerFrame;
+        zmq::message_t *dataFrame;
         void *data;
         size_t size;
-        EZMQMessage msg;
-        ezmq::Event event;
-        EZMQByteData byteData{NULL,0};
         std::string topic;
         int version;
         int contentType;
+        bool hasTopicFrame = false;
         bool isTopic = false;
-        unsigned char *ezmqHeader ;
+        size_t frameCount = 1;
+        EZMQHeader ezmqHeader;
 
         std::lock_guard<std::recursive_mutex> lock(mSubLock);
+        EZMQ_TRACE_SCOPE(receiveTrace, "receive");
+        EZMQ_TRACE_SCOPE(recvTrace, "recv");
         if(mSubscriber)
         {
             try
@@ -97,10 +140,31 @@ namespace ezmq
                 if(zFrame1.more())
                 {
                     mSubscriber->recv(&zFrame2);
+                    frameCount++;
                     if(zFrame2.more())
                     {
-                        isTopic = true;
+                        hasTopicFrame = true;
                         mSubscriber->recv(&zFrame3);
+                        frameCount++;
+
+                        //remaining segments of segmented byte data, excess frames are drained
+                        bool more = zFrame3.more();
+                        while(more)
+                        {
+                            if(frameCount < MAX_FRAME_COUNT)
+                            {
+                                segmentFrames.emplace_back();
+                                mSubscriber->recv(&segmentFrames.back());
+                                more = segmentFrames.back().more();
+                            }
+                            else
+                            {
+                                zmq::message_t excessFrame;
+                                mSubscriber->recv(&excessFrame);
+                                more = excessFrame.more();
+                            }
+                            frameCount++;
+                        }
                     }
                 }
             }
@@ -116,92 +180,450 @@ namespace ezmq
             return;
         }
 
-        if(false == isTopic)
+        EZMQ_TRACE_END(recvTrace);
+
+        //first of 3+ frames is topic, segmented byte data without topic has empty topic frame
+        EZMQ_TRACE_SCOPE(parseTrace, "parse");
+        headerFrame = hasTopicFrame ? &zFrame2 : &zFrame1;
+        if(EZMQ_OK != validateFrames(frameCount, hasTopicFrame, zFrame1, *headerFrame, ezmqHeader))
         {
-            //header
-            ezmqHeader = (unsigned char *)zFrame1.data();
+            mRejectedCount++;
+            return;
+        }
+        isTopic = hasTopicFrame && 0 != zFrame1.size();
 
+        if(false == hasTopicFrame)
+        {
             //data
+            dataFrame = &zFrame2;
             data = zFrame2.data();
             size = zFrame2.size();
         }
+        else if(false == isTopic)
+        {
+            //data
+            dataFrame = &zFrame3;
+            data = zFrame3.data();
+            size = zFrame3.size();
+        }
         else
         {
-            //header
-            ezmqHeader = (unsigned char *)zFrame2.data();
-
             //topic
             std::string topicStr(static_cast<char*>(zFrame1.data()), zFrame1.size());
             topic = topicStr;
+
+            // ZMQ filters only by literal prefix of wildcard topics
+            if(mTopicFilters.hasWildcards() && 0 == mTopicFilters.count(topic))
+            {
+                EZMQ_HOT_LOG_V(DEBUG, TAG, "[receive] Topic not matched: %s", topic.c_str());
+                return;
+            }
             if (topic.at(topic.length()-1) == '/')
             {
                 topic.erase(topic.length()-1);
             }
 
             //data
+            dataFrame = &zFrame3;
             data = zFrame3.data();
             size = zFrame3.size();
         }
 
-        contentType = ezmqHeader[0] >> CONTENT_TYPE_OFFSET;
-        version = (ezmqHeader[0] >> VERSION_OFFSET) & VERSION_MASK;
+        size_t bytes = zFrame1.size() + zFrame2.size() + zFrame3.size();
+        for (const auto &frame : segmentFrames)
+        {
+            bytes += frame.size();
+        }
+        mMetrics.add(topic, {{EZMQ_METRIC_MESSAGES_RECEIVED, 1}, {EZMQ_METRIC_BYTES_RECEIVED, bytes}});
 
-        //data
-        if(EZMQ_CONTENT_TYPE_PROTOBUF == contentType)
+        contentType = ezmqHeader.getContentType();
+        version = ezmqHeader.getVersion();
+
+        //publisher ID and sequence number, if enabled by publisher
+        if(ezmqHeader.hasSequence())
         {
-            event.mContentType = EZMQ_CONTENT_TYPE_PROTOBUF;
-            event.mVersion = version;
-            std::string msgStr(static_cast<char*>(data), size);
-            event.ParseFromString(msgStr);
-            //call application callback
-            if(false == isTopic)
+            trackSequence(topic, ezmqHeader.getPublisherId(), ezmqHeader.getSequence());
+        }
+
+        //decompress data, it should outlive the application callback
+        std::string decompressed;
+        EZMQCompressionCodec codec = ezmqHeader.getCompressionCodec();
+        if(EZMQ_COMPRESSION_NONE != codec)
+        {
+            EZMQErrorCode result = EZMQ_ERROR;
+            if(EZMQ_COMPRESSION_ZSTD_DICT == codec)
             {
-                if(NULL == mCallback)
+                unsigned int id = EZMQCompression::getDictionaryId(data, size);
+                auto it = mCompressionDictionaries.find(id);
+                if(it != mCompressionDictionaries.end())
+                {
+                    result = EZMQCompression::decompress(*(it->second), data, size, decompressed);
+                }
+                else
                 {
-                    mSubCallback(event);
-                    return;
+                    EZMQ_LOG_V(ERROR, TAG, "[receive] Unknown compression dictionary: %u", id);
                 }
-                mCallback->onMessageCB(event);
             }
             else
             {
-                if(NULL == mCallback)
-                {
-                    mSubTopicCallback(topic, event);
-                    return;
-                }
-                mCallback->onMessageCB(topic, event);
+                result = EZMQCompression::decompress(codec, data, size, decompressed);
             }
+            if(EZMQ_OK != result)
+            {
+                EZMQ_LOG_V(ERROR, TAG, "[receive] Decompression failed, codec: %d", codec);
+                return;
+            }
+            data = &decompressed[0];
+            size = decompressed.size();
+        }
+
+        //data, only the message of received content type is constructed
+        if(EZMQ_CONTENT_TYPE_PROTOBUF == contentType)
+        {
+            ezmq::Event event;
+            event.mContentType = EZMQ_CONTENT_TYPE_PROTOBUF;
+            event.mVersion = version;
+            event.mSchemaId = ezmqHeader.getSchemaId();
+            event.ParseFromArray(data, size);
+            EZMQ_TRACE_END(parseTrace);
+            dispatch(isTopic, topic, event, ezmqHeader);
         }
         else if(EZMQ_CONTENT_TYPE_BYTEDATA == contentType)
         {
-            byteData.mContentType = EZMQ_CONTENT_TYPE_BYTEDATA;
+            //adopt received data, application can retain it after callback
+            EZMQOwnedByteData byteData = (EZMQ_COMPRESSION_NONE == codec) ?
+                EZMQOwnedByteData(std::move(*dataFrame)) : EZMQOwnedByteData(std::move(decompressed));
             byteData.mVersion = version;
-            byteData.mData = (uint8_t *)data;
-            byteData.mDataLength = size;
-            //call application callback
-            if(false == isTopic)
+            byteData.mSchemaId = ezmqHeader.getSchemaId();
+            EZMQ_TRACE_END(parseTrace);
+            dispatch(isTopic, topic, byteData, ezmqHeader);
+        }
+        else if(EZMQ_CONTENT_TYPE_JSON == contentType)
+        {
+            EZMQJsonData jsonData("");
+            jsonData.mVersion = version;
+            jsonData.mSchemaId = ezmqHeader.getSchemaId();
+            jsonData.mJson.assign(static_cast<char*>(data), size);
+            EZMQ_TRACE_END(parseTrace);
+            dispatch(isTopic, topic, jsonData, ezmqHeader);
+        }
+        else if(EZMQ_CONTENT_TYPE_EVENT_BATCH == contentType)
+        {
+            EZMQEventBatch eventBatch;
+            eventBatch.mVersion = version;
+            eventBatch.mSchemaId = ezmqHeader.getSchemaId();
+            eventBatch.mData.assign(static_cast<char*>(data), size);
+            EZMQ_TRACE_END(parseTrace);
+            dispatch(isTopic, topic, eventBatch, ezmqHeader);
+        }
+        else if(EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA == contentType)
+        {
+            if(EZMQ_COMPRESSION_NONE != codec)
             {
-                if(NULL == mCallback)
+                EZMQ_LOG(ERROR, TAG, "[receive] Segmented byte data is not compressed");
+                return;
+            }
+            //adopt segment frames, application can retain them after callback
+            std::vector<zmq::message_t *> frames{dataFrame};
+            for (auto &frame : segmentFrames)
+            {
+                frames.push_back(&frame);
+            }
+            EZMQSegmentedByteData segmentedData;
+            segmentedData.mVersion = version;
+            segmentedData.mSchemaId = ezmqHeader.getSchemaId();
+            segmentedData.mSegments.reserve(frames.size());
+            for (auto frame : frames)
+            {
+                segmentedData.mSegments.push_back(EZMQOwnedByteData(std::move(*frame)));
+            }
+            EZMQ_TRACE_END(parseTrace);
+            dispatch(isTopic, topic, segmentedData, ezmqHeader);
+        }
+    }
+
+    void EZMQSubscriber::dispatch(bool isTopic, const std::string &topic, const EZMQMessage &message,
+        const EZMQHeader &header)
+    {
+        //publish timestamp, if enabled by publisher, latency is measured until callback
+        if(header.hasTimestamp())
+        {
+            trackLatency(topic, header.getTimestamp());
+        }
+        EZMQ_TRACE_SCOPE(callbackTrace, "callback");
+        EZMQMetrics::ScopeTimer timer(mMetrics, topic, EZMQ_METRIC_CALLBACK_TIME);
+        //call application callback
+        if(false == isTopic)
+        {
+            if(NULL == mCallback)
+            {
+                mSubCallback(message);
+                return;
+            }
+            mCallback->onMessageCB(message);
+        }
+        else
+        {
+            if(routeToHandlers(topic, message))
+            {
+                return;
+            }
+            if(NULL == mCallback)
+            {
+                mSubTopicCallback(topic, message);
+                return;
+            }
+            mCallback->onMessageCB(topic, message);
+        }
+    }
+
+    EZMQErrorCode EZMQSubscriber::validateFrames(size_t frameCount, bool hasTopicFrame,
+        const zmq::message_t &topicFrame, const zmq::message_t &headerFrame, EZMQHeader &header)
+    {
+        // Rejections are hot path logs, a flooding peer should not flood the log
+        if(frameCount < 2)
+        {
+            EZMQ_HOT_LOG(DEBUG, TAG, "[receive] Rejected, missing frames");
+            return EZMQ_ERROR;
+        }
+        if(EZMQ_OK != header.parse(headerFrame.data(), headerFrame.size()))
+        {
+            EZMQ_HOT_LOG(DEBUG, TAG, "[receive] Rejected, invalid EZMQ header");
+            return EZMQ_ERROR;
+        }
+        if(hasTopicFrame && 0 == topicFrame.size() &&
+            EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA != header.getContentType())
+        {
+            EZMQ_HOT_LOG(DEBUG, TAG, "[receive] Rejected, empty topic");
+            return EZMQ_ERROR;
+        }
+
+        size_t expectedCount = hasTopicFrame ? 3 : 2;
+        switch(header.getContentType())
+        {
+            case EZMQ_CONTENT_TYPE_PROTOBUF:
+            case EZMQ_CONTENT_TYPE_BYTEDATA:
+            case EZMQ_CONTENT_TYPE_JSON:
+            case EZMQ_CONTENT_TYPE_EVENT_BATCH:
+                if(frameCount != expectedCount)
+                {
+                    EZMQ_HOT_LOG_V(DEBUG, TAG, "[receive] Rejected, unexpected frame count: %zu", frameCount);
+                    return EZMQ_ERROR;
+                }
+                break;
+            case EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA:
+                if(frameCount < expectedCount || frameCount > MAX_FRAME_COUNT)
                 {
-                    mSubCallback(byteData);
-                    return;
+                    EZMQ_HOT_LOG_V(DEBUG, TAG, "[receive] Rejected, unexpected frame count: %zu", frameCount);
+                    return EZMQ_ERROR;
                 }
-                mCallback->onMessageCB(byteData);
+                break;
+            default:
+                EZMQ_HOT_LOG_V(DEBUG, TAG, "[receive] Rejected, not a supported type: %d",
+                    header.getContentType());
+                return EZMQ_ERROR;
+        }
+        return EZMQ_OK;
+    }
+
+    uint64_t EZMQSubscriber::getRejectedCount()
+    {
+        return mRejectedCount;
+    }
+
+    EZMQErrorCode EZMQSubscriber::setSocketMonitor(bool enable, EZMQSocketEventCB callback)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        std::lock_guard<std::recursive_mutex> lock(mSubLock);
+        if(mSubscriber)
+        {
+            EZMQ_LOG(ERROR, TAG, "Subscriber is already started");
+            return EZMQ_ERROR;
+        }
+        mSocketMonitorEnabled = enable;
+        mSocketEventCallback = callback;
+        if(!mSocketEventCallback && mCallback)
+        {
+            mSocketEventCallback = [this](EZMQSocketEvent event, const std::string &address)
+            {
+                mCallback->onSocketEventCB(event, address);
+            };
+        }
+        return EZMQ_OK;
+    }
+
+    uint64_t EZMQSubscriber::getSocketEventCount(EZMQSocketEvent event)
+    {
+        return mSocketMonitor.getEventCount(event);
+    }
+
+    void EZMQSubscriber::trackSequence(const std::string &topic, uint32_t publisherId, uint64_t sequence)
+    {
+        std::lock_guard<std::mutex> lock(mSequenceLock);
+        auto key = std::make_pair(publisherId, topic);
+        auto it = mLastSequences.find(key);
+        if(it == mLastSequences.end())
+        {
+            if(mLastSequences.size() >= MAX_TRACKED_SEQUENCES)
+            {
+                evictIdleSequences();
+            }
+            SequenceState state = {0, 0};
+            it = mLastSequences.insert(std::make_pair(key, state)).first;
+        }
+        it->second.lastTracked = ++mTrackedCount;
+        uint64_t &lastSequence = it->second.sequence;
+        if(0 != lastSequence && sequence > lastSequence + 1)
+        {
+            uint64_t dropped = sequence - lastSequence - 1;
+            mDroppedCount += dropped;
+            // Topics beyond the limit are counted only in total
+            auto count = mDroppedCounts.find(topic);
+            if(count == mDroppedCounts.end() && mDroppedCounts.size() < MAX_DROPPED_TOPICS)
+            {
+                count = mDroppedCounts.insert(std::make_pair(topic, 0)).first;
+            }
+            if(count != mDroppedCounts.end())
+            {
+                count->second += dropped;
+            }
+            EZMQ_HOT_LOG_V(DEBUG, TAG, "[receive] Dropped %llu messages [Topic]: %s",
+                (unsigned long long)dropped, topic.c_str());
+        }
+        // Older sequence is a resent last value or a duplicate, not a gap
+        if(sequence > lastSequence)
+        {
+            lastSequence = sequence;
+        }
+    }
+
+    void EZMQSubscriber::evictIdleSequences()
+    {
+        // Restarted publishers get new IDs, so forget the least recently received half
+        std::vector<uint64_t> lastTracked;
+        lastTracked.reserve(mLastSequences.size());
+        for (const auto &entry : mLastSequences)
+        {
+            lastTracked.push_back(entry.second.lastTracked);
+        }
+        auto middle = lastTracked.begin() + lastTracked.size() / 2;
+        std::nth_element(lastTracked.begin(), middle, lastTracked.end());
+        for (auto it = mLastSequences.begin(); it != mLastSequences.end();)
+        {
+            if(it->second.lastTracked < *middle)
+            {
+                it = mLastSequences.erase(it);
             }
             else
             {
-                if(NULL == mCallback)
-                {
-                    mSubTopicCallback(topic, byteData);
-                    return;
-                }
-                mCallback->onMessageCB(topic, byteData);
+                ++it;
             }
         }
+        EZMQ_LOG_V(DEBUG, TAG, "Sequence tracking evicted, tracked: %zu", mLastSequences.size());
+    }
+
+    uint64_t EZMQSubscriber::getDroppedCount()
+    {
+        std::lock_guard<std::mutex> lock(mSequenceLock);
+        return mDroppedCount;
+    }
+
+    uint64_t EZMQSubscriber::getDroppedCount(const std::string &topic)
+    {
+        std::lock_guard<std::mutex> lock(mSequenceLock);
+        auto it = mDroppedCounts.find(topic);
+        return it == mDroppedCounts.end() ? 0 : it->second;
+    }
+
+    void EZMQSubscriber::trackLatency(const std::string &topic, uint64_t timestamp)
+    {
+        if(0 == timestamp)
+        {
+            // Resent last value, it was not published now
+            return;
+        }
+        uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        uint64_t latency = now > timestamp ? now - timestamp : 0;
+
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        mAllLatencies.record(latency);
+        // Topics beyond the limit are recorded only in histogram of all topics
+        auto it = mLatencies.find(topic);
+        if(it == mLatencies.end() && mLatencies.size() < MAX_LATENCY_TOPICS)
+        {
+            it = mLatencies.insert(std::make_pair(topic, EZMQLatencyHistogram())).first;
+        }
+        if(it != mLatencies.end())
+        {
+            it->second.record(latency);
+        }
+    }
+
+    EZMQErrorCode EZMQSubscriber::getLatencyHistogram(const std::string &topic,
+        EZMQLatencyHistogram &histogram)
+    {
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        auto it = mLatencies.find(topic);
+        if(it == mLatencies.end())
+        {
+            return EZMQ_ERROR;
+        }
+        histogram = it->second;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQSubscriber::getLatencyHistogram(EZMQLatencyHistogram &histogram)
+    {
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        if(0 == mAllLatencies.getCount())
+        {
+            return EZMQ_ERROR;
+        }
+        histogram = mAllLatencies;
+        return EZMQ_OK;
+    }
+
+    void EZMQSubscriber::resetLatencyHistograms()
+    {
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        mLatencies.clear();
+        mAllLatencies.reset();
+    }
+
+    bool EZMQSubscriber::routeToHandlers(const std::string &topic, const EZMQMessage &event)
+    {
+        if(mTopicHandlers.empty())
+        {
+            return false;
+        }
+        // Handlers are invoked in place, changes made by them are applied after dispatch
+        HandlerContext context = {&topic, &event};
+        mDispatching = true;
+        size_t count = mTopicHandlers.match(topic, invokeHandler, &context);
+        mDispatching = false;
+        for (auto &pending : mPendingHandlers)
+        {
+            setTopicHandler(pending.first, pending.second);
+        }
+        mPendingHandlers.clear();
+        return 0 != count;
+    }
+
+    void EZMQSubscriber::setTopicHandler(const std::string &topic, EZMQSubTopicCB handler)
+    {
+        if(mDispatching)
+        {
+            mPendingHandlers.push_back(std::make_pair(topic, handler));
+        }
+        else if(handler)
+        {
+            mTopicHandlers.insert(topic, handler);
+        }
         else
         {
-            EZMQ_LOG_V(ERROR, TAG, "[receive] Not a supported type: %d", contentType);
+            mTopicHandlers.erase(topic);
         }
     }
 
@@ -265,6 +687,20 @@ namespace ezmq
         return EZMQ_OK;
     }
 
+    EZMQErrorCode EZMQSubscriber::addCompressionDictionary(
+        std::shared_ptr<EZMQCompressionDictionary> dictionary)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, __func__);
+        if(nullptr == dictionary || 0 == dictionary->getId())
+        {
+            EZMQ_LOG(ERROR, TAG, "Invalid dictionary");
+            return EZMQ_ERROR;
+        }
+        std::lock_guard<std::recursive_mutex> lock(mSubLock);
+        mCompressionDictionaries[dictionary->getId()] = dictionary;
+        return EZMQ_OK;
+    }
+
     EZMQErrorCode EZMQSubscriber::start()
     {
         EZMQ_SCOPE_LOGGER(TAG, __func__);
@@ -298,6 +734,13 @@ namespace ezmq
             {
                 mSubscriber = new zmq::socket_t(*mContext, ZMQ_SUB);
                 ALLOC_ASSERT(mSubscriber)
+
+                // Monitor before connect, so first connect is not missed
+                if(mSocketMonitorEnabled && EZMQ_OK != mSocketMonitor.start(*mSubscriber,
+                    mSocketEventCallback))
+                {
+                    EZMQ_LOG(ERROR, TAG, "Failed to start socket monitor");
+                }
 #ifdef SECURITY_ENABLED
                 //Set sever public key
                 if (mServerPublicKey.length() == KEY_LENGTH)
@@ -377,7 +820,13 @@ namespace ezmq
         try
         {
             VERIFY_NON_NULL(mSubscriber)
-            mSubscriber->setsockopt(ZMQ_SUBSCRIBE, topic.c_str(), topic.size());
+            // ZMQ counts subscriptions, so subscribe only once for each topic
+            if(!mTopicFilters.contains(topic))
+            {
+                std::string prefix = EZMQTopicTrie::getLiteralPrefix(topic);
+                mSubscriber->setsockopt(ZMQ_SUBSCRIBE, prefix.c_str(), prefix.size());
+                mTopicFilters.insert(topic, nullptr);
+            }
         }
         catch (std::exception &e)
         {
@@ -409,6 +858,30 @@ namespace ezmq
         return result;
     }
 
+    EZMQErrorCode EZMQSubscriber::subscribe(std::string topic, EZMQSubTopicCB handler)
+    {
+        EZMQ_SCOPE_LOGGER(TAG, "subscribe [Topic Handler]");
+        if(!handler)
+        {
+            EZMQ_LOG(ERROR, TAG, "Handler is null");
+            return EZMQ_ERROR;
+        }
+        //Validate Topic
+        topic = sanitizeTopic(topic);
+        if(topic.empty())
+        {
+            return EZMQ_INVALID_TOPIC;
+        }
+        EZMQ_LOG_V(DEBUG, TAG, "Topic: %s", topic.c_str());
+        std::lock_guard<std::recursive_mutex> lock(mSubLock);
+        EZMQErrorCode result = subscribeInternal(topic);
+        if(EZMQ_OK == result)
+        {
+            setTopicHandler(topic, handler);
+        }
+        return result;
+    }
+
     EZMQErrorCode EZMQSubscriber::subscribe(const std::string &ip, const int &port, std::string topic)
     {
         EZMQ_SCOPE_LOGGER(TAG, "subscribe [Topic]");
@@ -459,7 +932,12 @@ namespace ezmq
 #endif // SECURITY_ENABLED
 
             mSubscriber->connect(getSocketAddress(ip, port));
-            mSubscriber->setsockopt(ZMQ_SUBSCRIBE, topic.c_str(), topic.size());
+            if(!mTopicFilters.contains(topic))
+            {
+                std::string prefix = EZMQTopicTrie::getLiteralPrefix(topic);
+                mSubscriber->setsockopt(ZMQ_SUBSCRIBE, prefix.c_str(), prefix.size());
+                mTopicFilters.insert(topic, nullptr);
+            }
         }
         catch (std::exception &e)
         {
@@ -487,7 +965,13 @@ namespace ezmq
             return EZMQ_INVALID_TOPIC;
         }
         EZMQ_LOG_V(DEBUG, TAG, "Topic: %s", topic.c_str());
-        return unSubscribeInternal(topic);
+        std::lock_guard<std::recursive_mutex> lock(mSubLock);
+        EZMQErrorCode result = unSubscribeInternal(topic);
+        if(EZMQ_OK == result)
+        {
+            setTopicHandler(topic, nullptr);
+        }
+        return result;
     }
 
     EZMQErrorCode EZMQSubscriber::unSubscribeInternal(std::string &topic)
@@ -498,7 +982,13 @@ namespace ezmq
         try
         {
             VERIFY_NON_NULL(mSubscriber)
-            mSubscriber->setsockopt(ZMQ_UNSUBSCRIBE ,  topic.c_str(), topic.size());
+            // Unsubscribe only once for each subscribed topic, same as subscribe
+            if(mTopicFilters.contains(topic))
+            {
+                std::string prefix = EZMQTopicTrie::getLiteralPrefix(topic);
+                mSubscriber->setsockopt(ZMQ_UNSUBSCRIBE ,  prefix.c_str(), prefix.size());
+                mTopicFilters.erase(topic);
+            }
         }
         catch (std::exception e)
         {
@@ -571,7 +1061,19 @@ namespace ezmq
             // clear the keys
             clearKeys();
 
+            // subscriptions are gone with the socket
+            mTopicHandlers.clear();
+            mPendingHandlers.clear();
+            mTopicFilters.clear();
+
+            // messages missed while stopped are not drops
+            {
+                std::lock_guard<std::mutex> sequenceLock(mSequenceLock);
+                mLastSequences.clear();
+            }
+
             // close subscriber socket
+            mSocketMonitor.stop();
             if (mSubscriber)
             {
                 mSubscriber->close();
@@ -607,6 +1109,11 @@ namespace ezmq
         return mPort;
     }
 
+    EZMQMetrics &EZMQSubscriber::getMetrics()
+    {
+        return mMetrics;
+    }
+
     std::string EZMQSubscriber::getSocketAddress(const std::string &ip, const int &port)
     {
         try
@@ -642,6 +1149,11 @@ namespace ezmq
         return "";
     }
 #endif
+        if(!EZMQTopicTrie::isValidWildcard(topic))
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Invalid wildcard topic: %s", topic.c_str());
+            return "";
+        }
         try
         {
             if (topic.at(topic.length()-1) != '/')
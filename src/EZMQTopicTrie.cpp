@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQTopicTrie.h"
+
+#define TOPIC_SEPARATOR '/'
+#define SINGLE_LEVEL_WILDCARD '+'
+#define MULTI_LEVEL_WILDCARD '#'
+#define WILDCARDS "+#"
+
+namespace ezmq
+{
+    // Topic is matched as if it ends with separator
+    static inline char charAt(const std::string &topic, size_t index)
+    {
+        return (index < topic.size()) ? topic[index] : TOPIC_SEPARATOR;
+    }
+
+    EZMQTopicTrie::EZMQTopicTrie() : mSize(0), mWildcards(0)
+    {
+    }
+
+    void EZMQTopicTrie::insert(const std::string &topic, const Handler &handler)
+    {
+        Node *node = &mRoot;
+        for (char c : topic)
+        {
+            std::unique_ptr<Node> &child = node->children[c];
+            if(!child)
+            {
+                child.reset(new Node());
+            }
+            node = child.get();
+        }
+        if(!node->isTopic)
+        {
+            node->isTopic = true;
+            node->isExact = isWildcard(topic);
+            mSize++;
+            if(node->isExact)
+            {
+                mWildcards++;
+            }
+        }
+        node->handler = handler;
+    }
+
+    bool EZMQTopicTrie::erase(const std::string &topic)
+    {
+        Node *node = &mRoot;
+        for (char c : topic)
+        {
+            auto it = node->children.find(c);
+            if(it == node->children.end())
+            {
+                return false;
+            }
+            node = it->second.get();
+        }
+        if(!node->isTopic)
+        {
+            return false;
+        }
+        if(node->isExact)
+        {
+            mWildcards--;
+        }
+        eraseInternal(mRoot, topic, 0);
+        mSize--;
+        return true;
+    }
+
+    bool EZMQTopicTrie::eraseInternal(Node &node, const std::string &topic, size_t index)
+    {
+        if(index == topic.size())
+        {
+            node.handler = nullptr;
+            node.isTopic = false;
+            node.isExact = false;
+        }
+        else
+        {
+            auto it = node.children.find(topic[index]);
+            // prune the branch which has no topic left
+            if(eraseInternal(*(it->second), topic, index + 1))
+            {
+                node.children.erase(it);
+            }
+        }
+        return !node.isTopic && node.children.empty();
+    }
+
+    size_t EZMQTopicTrie::match(const std::string &topic, std::vector<Handler> &handlers) const
+    {
+        return matchInternal(mRoot, topic, getLength(topic), 0, appendHandler, &handlers);
+    }
+
+    size_t EZMQTopicTrie::match(const std::string &topic, Visitor visitor, void *context) const
+    {
+        return matchInternal(mRoot, topic, getLength(topic), 0, visitor, context);
+    }
+
+    void EZMQTopicTrie::appendHandler(const Handler &handler, void *context)
+    {
+        static_cast<std::vector<Handler> *>(context)->push_back(handler);
+    }
+
+    bool EZMQTopicTrie::contains(const std::string &topic) const
+    {
+        const Node *node = &mRoot;
+        for (char c : topic)
+        {
+            auto it = node->children.find(c);
+            if(it == node->children.end())
+            {
+                return false;
+            }
+            node = it->second.get();
+        }
+        return node->isTopic;
+    }
+
+    bool EZMQTopicTrie::hasPrefixOf(const std::string &topic) const
+    {
+        const Node *node = &mRoot;
+        for (size_t i = 0; ; i++)
+        {
+            if(node->isTopic)
+            {
+                return true;
+            }
+            if(i == topic.size())
+            {
+                return false;
+            }
+            auto it = node->children.find(topic[i]);
+            if(it == node->children.end())
+            {
+                return false;
+            }
+            node = it->second.get();
+        }
+    }
+
+    size_t EZMQTopicTrie::count(const std::string &topic) const
+    {
+        return matchInternal(mRoot, topic, getLength(topic), 0, NULL, NULL);
+    }
+
+    size_t EZMQTopicTrie::getLength(const std::string &topic)
+    {
+        size_t length = topic.size();
+        if(!length || TOPIC_SEPARATOR != topic[length - 1])
+        {
+            // match as sanitized topic
+            length++;
+        }
+        return length;
+    }
+
+    size_t EZMQTopicTrie::matchInternal(const Node &node, const std::string &topic, size_t length,
+        size_t index, Visitor visitor, void *context)
+    {
+        size_t count = 0;
+        const Node *current = &node;
+        for (size_t i = index; ; i++)
+        {
+            if(current->isTopic && (!current->isExact || i == length))
+            {
+                if(visitor)
+                {
+                    visitor(current->handler, context);
+                }
+                count++;
+            }
+
+            // Wildcards occupy whole level, so look for them only at start of level
+            bool isLevelStart = (0 == i) || (TOPIC_SEPARATOR == charAt(topic, i - 1));
+            if(isLevelStart && !current->children.empty())
+            {
+                auto it = current->children.find(MULTI_LEVEL_WILDCARD);
+                if(it != current->children.end())
+                {
+                    // '#' matches rest of the topic
+                    auto end = it->second->children.find(TOPIC_SEPARATOR);
+                    if(end != it->second->children.end() && end->second->isTopic)
+                    {
+                        if(visitor)
+                        {
+                            visitor(end->second->handler, context);
+                        }
+                        count++;
+                    }
+                }
+                it = current->children.find(SINGLE_LEVEL_WILDCARD);
+                if(i < length && it != current->children.end())
+                {
+                    // '+' matches till the end of level
+                    size_t next = i;
+                    while(TOPIC_SEPARATOR != charAt(topic, next))
+                    {
+                        next++;
+                    }
+                    count += matchInternal(*(it->second), topic, length, next, visitor, context);
+                }
+            }
+
+            if(i == length)
+            {
+                return count;
+            }
+            auto it = current->children.find(charAt(topic, i));
+            if(it == current->children.end())
+            {
+                return count;
+            }
+            current = it->second.get();
+        }
+    }
+
+    bool EZMQTopicTrie::empty() const
+    {
+        return 0 == mSize;
+    }
+
+    bool EZMQTopicTrie::hasWildcards() const
+    {
+        return 0 != mWildcards;
+    }
+
+    void EZMQTopicTrie::clear()
+    {
+        mRoot.children.clear();
+        mRoot.handler = nullptr;
+        mRoot.isTopic = false;
+        mRoot.isExact = false;
+        mSize = 0;
+        mWildcards = 0;
+    }
+
+    bool EZMQTopicTrie::isWildcard(const std::string &topic)
+    {
+        return std::string::npos != topic.find_first_of(WILDCARDS);
+    }
+
+    bool EZMQTopicTrie::isValidWildcard(const std::string &topic)
+    {
+        size_t start = 0;
+        while(start <= topic.size())
+        {
+            size_t end = topic.find(TOPIC_SEPARATOR, start);
+            if(std::string::npos == end)
+            {
+                end = topic.size();
+            }
+            size_t wildcard = topic.find_first_of(WILDCARDS, start);
+            if(std::string::npos != wildcard && wildcard < end)
+            {
+                // wildcard should be the whole level
+                if(1 != end - start)
+                {
+                    return false;
+                }
+                // '#' should be the last level
+                if(MULTI_LEVEL_WILDCARD == topic[start] && end + 1 < topic.size())
+                {
+                    return false;
+                }
+            }
+            start = end + 1;
+        }
+        return true;
+    }
+
+    std::string EZMQTopicTrie::getLiteralPrefix(const std::string &topic)
+    {
+        size_t wildcard = topic.find_first_of(WILDCARDS);
+        if(std::string::npos == wildcard)
+        {
+            return topic;
+        }
+        return topic.substr(0, wildcard);
+    }
+}
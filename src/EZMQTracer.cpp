@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <chrono>
+#include <fstream>
+
+#include "EZMQTracer.h"
+#include "EZMQLogger.h"
+
+#define TAG "EZMQTracer"
+
+namespace ezmq
+{
+    EZMQTracer &EZMQTracer::getInstance()
+    {
+        static EZMQTracer instance;
+        return instance;
+    }
+
+    EZMQTracer::EZMQTracer() : mRecording(false), mDroppedCount(0), mStartTime(0),
+        mNextThreadId(1)
+    {
+    }
+
+    EZMQErrorCode EZMQTracer::start(const std::string &path)
+    {
+        std::lock_guard<std::mutex> lock(mTracerLock);
+        if(mRecording)
+        {
+            EZMQ_LOG(ERROR, TAG, "Already recording");
+            return EZMQ_ERROR;
+        }
+        removeClosedBuffers();
+        for (auto &buffer : mBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->lock);
+            buffer->events.clear();
+        }
+        mPath = path;
+        mDroppedCount = 0;
+        mStartTime = now();
+        mRecording = true;
+        return EZMQ_OK;
+    }
+
+    EZMQErrorCode EZMQTracer::stop()
+    {
+        std::lock_guard<std::mutex> lock(mTracerLock);
+        if(!mRecording)
+        {
+            EZMQ_LOG(ERROR, TAG, "Not recording");
+            return EZMQ_ERROR;
+        }
+        mRecording = false;
+
+        std::ofstream file(mPath.c_str(), std::ios::out | std::ios::trunc);
+        if(!file)
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Failed to open: %s", mPath.c_str());
+            return EZMQ_ERROR;
+        }
+
+        // Chrome trace event format, complete events with times in microseconds
+        char line[256];
+        bool first = true;
+        file << "{\"traceEvents\":[";
+        for (auto &buffer : mBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->lock);
+            for (const auto &event : buffer->events)
+            {
+                if(event.start < mStartTime)
+                {
+                    continue;
+                }
+                snprintf(line, sizeof(line),
+                    "%s\n{\"name\":\"%s\",\"cat\":\"ezmq\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"pid\":1,\"tid\":%u}", first ? "" : ",", event.name,
+                    (event.start - mStartTime) / 1000.0, (event.end - event.start) / 1000.0,
+                    buffer->threadId);
+                file << line;
+                first = false;
+            }
+            buffer->events.clear();
+        }
+        removeClosedBuffers();
+        file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        if(!file.flush())
+        {
+            EZMQ_LOG_V(ERROR, TAG, "Failed to write: %s", mPath.c_str());
+            return EZMQ_ERROR;
+        }
+        if(0 != mDroppedCount)
+        {
+            EZMQ_LOG_V(WARNING, TAG, "Dropped trace events: %llu",
+                (unsigned long long)mDroppedCount.load());
+        }
+        return EZMQ_OK;
+    }
+
+    bool EZMQTracer::isRecording() const
+    {
+        return mRecording.load(std::memory_order_relaxed);
+    }
+
+    EZMQTracer::ThreadBuffer *EZMQTracer::getBuffer()
+    {
+        static thread_local BufferHolder holder;
+        if(!holder.buffer)
+        {
+            holder.buffer = std::make_shared<ThreadBuffer>();
+            std::lock_guard<std::mutex> lock(mTracerLock);
+            holder.buffer->threadId = mNextThreadId++;
+            mBuffers.push_back(holder.buffer);
+        }
+        return holder.buffer.get();
+    }
+
+    void EZMQTracer::release(const std::shared_ptr<ThreadBuffer> &buffer)
+    {
+        std::lock_guard<std::mutex> lock(mTracerLock);
+        buffer->closed = true;
+        if(!mRecording)
+        {
+            removeClosedBuffers();
+        }
+    }
+
+    void EZMQTracer::removeClosedBuffers()
+    {
+        // Caller holds mTracerLock. While recording, stop() writes the events first
+        for (auto it = mBuffers.begin(); it != mBuffers.end();)
+        {
+            if((*it)->closed)
+            {
+                it = mBuffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    EZMQTracer::BufferHolder::~BufferHolder()
+    {
+        if(buffer)
+        {
+            EZMQTracer::getInstance().release(buffer);
+        }
+    }
+
+    void EZMQTracer::record(const char *name, uint64_t start, uint64_t end)
+    {
+        if(!isRecording())
+        {
+            return;
+        }
+        ThreadBuffer *buffer = getBuffer();
+        std::lock_guard<std::mutex> lock(buffer->lock);
+        if(buffer->events.size() >= EZMQ_MAX_TRACE_EVENTS)
+        {
+            mDroppedCount++;
+            return;
+        }
+        Event event = {name, start, end};
+        buffer->events.push_back(event);
+    }
+
+    uint64_t EZMQTracer::getDroppedCount() const
+    {
+        return mDroppedCount;
+    }
+
+    uint64_t EZMQTracer::now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    EZMQTraceScope::EZMQTraceScope(const char *name) : mName(name), mStart(0)
+    {
+        if(EZMQTracer::getInstance().isRecording())
+        {
+            mStart = EZMQTracer::now();
+        }
+    }
+
+    EZMQTraceScope::~EZMQTraceScope()
+    {
+        end();
+    }
+
+    void EZMQTraceScope::end()
+    {
+        if(0 != mStart)
+        {
+            EZMQTracer::getInstance().record(mName, mStart, EZMQTracer::now());
+            mStart = 0;
+        }
+    }
+}
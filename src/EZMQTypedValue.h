@@ -0,0 +1,46 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * @file   EZMQTypedValue.h
+ *
+ * @brief This file contains internal helpers for typed values of Reading.
+ */
+
+#ifndef EZMQ_TYPEDVALUE_H_
+#define EZMQ_TYPEDVALUE_H_
+
+#include "Event.pb.h"
+
+namespace ezmq
+{
+    /**
+     * Check whether reading has any typed value [double, int, binary or their arrays].
+     *
+     * @param reading - Reading to be checked.
+     *
+     * @return true if reading has a typed value.
+     */
+    inline bool hasTypedValue(const Reading &reading)
+    {
+        return reading.has_double_value() || reading.has_int_value() ||
+            reading.has_binary_value() || reading.double_values_size() ||
+            reading.int_values_size();
+    }
+}
+
+#endif // EZMQ_TYPEDVALUE_H_
@@ -0,0 +1,773 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <chrono>
+
+#include "EZMQAsyncLogger.h"
+#include "EZMQLogger.h"
+
+// Interval the background thread waits for new records
+#define DRAIN_INTERVAL_MS (10)
+
+// Max size of a single conversion specification
+#define MAX_SPEC_SIZE (32)
+
+namespace ezmq
+{
+    namespace
+    {
+        enum LengthModifier
+        {
+            LENGTH_NONE = 0,
+            LENGTH_HH,
+            LENGTH_H,
+            LENGTH_L,
+            LENGTH_LL,
+            LENGTH_Z,
+            LENGTH_J,
+            LENGTH_T,
+            LENGTH_LONG_DOUBLE
+        };
+
+        struct ConversionSpec
+        {
+            const char *flags;
+            size_t flagsSize;
+            const char *width;
+            size_t widthSize;
+            bool widthStar;
+            bool hasPrecision;
+            const char *precision;
+            size_t precisionSize;
+            bool precisionStar;
+            int length;
+            char conversion;
+        };
+
+        bool isFlag(char c)
+        {
+            return '-' == c || '+' == c || ' ' == c || '#' == c || '0' == c || '\'' == c;
+        }
+
+        bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        // Parse a conversion specification, p points after '%'
+        const char *parseSpec(const char *p, ConversionSpec &spec)
+        {
+            memset(&spec, 0, sizeof(spec));
+            spec.flags = p;
+            while (isFlag(*p))
+            {
+                p++;
+            }
+            spec.flagsSize = p - spec.flags;
+
+            spec.width = p;
+            if ('*' == *p)
+            {
+                spec.widthStar = true;
+                p++;
+            }
+            while (isDigit(*p))
+            {
+                p++;
+            }
+            spec.widthSize = p - spec.width;
+
+            if ('.' == *p)
+            {
+                spec.hasPrecision = true;
+                p++;
+                spec.precision = p;
+                if ('*' == *p)
+                {
+                    spec.precisionStar = true;
+                    p++;
+                }
+                while (isDigit(*p))
+                {
+                    p++;
+                }
+                spec.precisionSize = p - spec.precision;
+            }
+
+            switch (*p)
+            {
+                case 'h':
+                    p++;
+                    spec.length = LENGTH_H;
+                    if ('h' == *p)
+                    {
+                        p++;
+                        spec.length = LENGTH_HH;
+                    }
+                    break;
+                case 'l':
+                    p++;
+                    spec.length = LENGTH_L;
+                    if ('l' == *p)
+                    {
+                        p++;
+                        spec.length = LENGTH_LL;
+                    }
+                    break;
+                case 'q':
+                    p++;
+                    spec.length = LENGTH_LL;
+                    break;
+                case 'z':
+                    p++;
+                    spec.length = LENGTH_Z;
+                    break;
+                case 'j':
+                    p++;
+                    spec.length = LENGTH_J;
+                    break;
+                case 't':
+                    p++;
+                    spec.length = LENGTH_T;
+                    break;
+                case 'L':
+                    p++;
+                    spec.length = LENGTH_LONG_DOUBLE;
+                    break;
+                default:
+                    break;
+            }
+
+            spec.conversion = *p;
+            if (*p)
+            {
+                p++;
+            }
+            return p;
+        }
+
+        int64_t readSigned(int length, va_list &args)
+        {
+            switch (length)
+            {
+                case LENGTH_NONE:
+                    return va_arg(args, int);
+                case LENGTH_HH:
+                    return static_cast<signed char>(va_arg(args, int));
+                case LENGTH_H:
+                    return static_cast<short>(va_arg(args, int));
+                case LENGTH_L:
+                    return va_arg(args, long);
+                case LENGTH_LL:
+                    return va_arg(args, long long);
+                case LENGTH_Z:
+                    return static_cast<ptrdiff_t>(va_arg(args, size_t));
+                case LENGTH_J:
+                    return va_arg(args, intmax_t);
+                case LENGTH_T:
+                    return va_arg(args, ptrdiff_t);
+                default:
+                    return 0;
+            }
+        }
+
+        uint64_t readUnsigned(int length, va_list &args)
+        {
+            switch (length)
+            {
+                case LENGTH_NONE:
+                    return va_arg(args, unsigned int);
+                case LENGTH_HH:
+                    return static_cast<unsigned char>(va_arg(args, unsigned int));
+                case LENGTH_H:
+                    return static_cast<unsigned short>(va_arg(args, unsigned int));
+                case LENGTH_L:
+                    return va_arg(args, unsigned long);
+                case LENGTH_LL:
+                    return va_arg(args, unsigned long long);
+                case LENGTH_Z:
+                    return va_arg(args, size_t);
+                case LENGTH_J:
+                    return va_arg(args, uintmax_t);
+                case LENGTH_T:
+                    return static_cast<size_t>(va_arg(args, ptrdiff_t));
+                default:
+                    return 0;
+            }
+        }
+
+        bool addArg(EZMQLogRecord &record, const EZMQLogArg &arg)
+        {
+            if (record.argCount >= EZMQ_LOG_RECORD_MAX_ARGS)
+            {
+                return false;
+            }
+            record.args[record.argCount++] = arg;
+            return true;
+        }
+
+        bool addInt(EZMQLogRecord &record, int64_t value)
+        {
+            EZMQLogArg arg;
+            arg.type = 'i';
+            arg.value.i = value;
+            return addArg(record, arg);
+        }
+
+        bool addString(EZMQLogRecord &record, const char *str, size_t maxSize)
+        {
+            if (!str)
+            {
+                str = "(null)";
+            }
+            size_t available = EZMQ_LOG_RECORD_STRING_SIZE - record.stringSize;
+            if (0 == available)
+            {
+                return false;
+            }
+            size_t size = 0;
+            while (size < available - 1 && size < maxSize && str[size])
+            {
+                size++;
+            }
+            EZMQLogArg arg;
+            arg.type = 's';
+            arg.value.offset = record.stringSize;
+            memcpy(record.strings + record.stringSize, str, size);
+            record.strings[record.stringSize + size] = '\0';
+            record.stringSize += size + 1;
+            return addArg(record, arg);
+        }
+
+        void appendText(char *buffer, size_t size, size_t &used, const char *text, size_t textSize)
+        {
+            while (textSize-- && used + 1 < size)
+            {
+                buffer[used++] = *text++;
+            }
+        }
+
+        void appendFormatted(size_t size, size_t &used, int written)
+        {
+            if (written > 0)
+            {
+                used += static_cast<size_t>(written);
+                if (used > size - 1)
+                {
+                    used = size - 1;
+                }
+            }
+        }
+
+        bool captureArgs(EZMQLogRecord &record, va_list &args)
+        {
+            record.argCount = 0;
+            record.stringSize = 0;
+            const char *p = record.format;
+            while (*p)
+            {
+                if ('%' != *p++)
+                {
+                    continue;
+                }
+                if ('%' == *p)
+                {
+                    p++;
+                    continue;
+                }
+
+                ConversionSpec spec;
+                p = parseSpec(p, spec);
+                if (spec.widthStar && !addInt(record, va_arg(args, int)))
+                {
+                    return false;
+                }
+
+                size_t maxSize = EZMQ_LOG_RECORD_STRING_SIZE;
+                if (spec.precisionStar)
+                {
+                    int precision = va_arg(args, int);
+                    if (!addInt(record, precision))
+                    {
+                        return false;
+                    }
+                    if (precision >= 0)
+                    {
+                        maxSize = precision;
+                    }
+                }
+                else if (spec.hasPrecision)
+                {
+                    maxSize = strtoul(spec.precision, NULL, 10);
+                }
+
+                EZMQLogArg arg;
+                arg.type = spec.conversion;
+                switch (spec.conversion)
+                {
+                    case 'd':
+                    case 'i':
+                        if (LENGTH_LONG_DOUBLE == spec.length)
+                        {
+                            return false;
+                        }
+                        arg.value.i = readSigned(spec.length, args);
+                        break;
+                    case 'u':
+                    case 'o':
+                    case 'x':
+                    case 'X':
+                        if (LENGTH_LONG_DOUBLE == spec.length)
+                        {
+                            return false;
+                        }
+                        arg.value.u = readUnsigned(spec.length, args);
+                        break;
+                    case 'c':
+                        if (LENGTH_NONE != spec.length)
+                        {
+                            return false;
+                        }
+                        arg.value.i = va_arg(args, int);
+                        break;
+                    case 'f':
+                    case 'F':
+                    case 'e':
+                    case 'E':
+                    case 'g':
+                    case 'G':
+                    case 'a':
+                    case 'A':
+                        if (LENGTH_LONG_DOUBLE == spec.length)
+                        {
+                            return false;
+                        }
+                        arg.value.d = va_arg(args, double);
+                        break;
+                    case 'p':
+                        arg.value.p = va_arg(args, void *);
+                        break;
+                    case 's':
+                        if (LENGTH_NONE != spec.length ||
+                            !addString(record, va_arg(args, const char *), maxSize))
+                        {
+                            return false;
+                        }
+                        continue;
+                    default:
+                        return false;
+                }
+                if (!addArg(record, arg))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    EZMQAsyncLogger::RingHolder::~RingHolder()
+    {
+        if (ring)
+        {
+            ring->closed.store(true, std::memory_order_release);
+        }
+    }
+
+    EZMQAsyncLogger &EZMQAsyncLogger::getInstance()
+    {
+        static EZMQAsyncLogger instance;
+        return instance;
+    }
+
+    EZMQAsyncLogger::EZMQAsyncLogger() : mRunning(false), mDroppedCount(0), mTime(0),
+        mGeneration(0), mReportedDrops(0)
+    {
+    }
+
+    EZMQAsyncLogger::~EZMQAsyncLogger()
+    {
+        stop();
+    }
+
+    void EZMQAsyncLogger::start()
+    {
+        std::lock_guard<std::mutex> lock(mThreadLock);
+        if (mRunning)
+        {
+            return;
+        }
+        mTime.store(EZMQLogTime(), std::memory_order_relaxed);
+        mRunning = true;
+        mThread = std::thread(&EZMQAsyncLogger::run, this, ++mGeneration);
+    }
+
+    void EZMQAsyncLogger::stop()
+    {
+        std::thread thread;
+        {
+            std::lock_guard<std::mutex> lock(mThreadLock);
+            if (!mRunning)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> waitLock(mWaitLock);
+                mRunning = false;
+            }
+            thread.swap(mThread);
+        }
+        mWaitCond.notify_all();
+
+        // Joined unlocked, a sink called by the background thread may stop logging
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            thread.detach();
+        }
+        else if (thread.joinable())
+        {
+            thread.join();
+        }
+        mTime.store(0, std::memory_order_relaxed);
+
+        // Pairs with commit(), a record this drain misses is written by its producer
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        drain();
+    }
+
+    bool EZMQAsyncLogger::isRunning() const
+    {
+        return mRunning.load(std::memory_order_relaxed);
+    }
+
+    uint64_t EZMQAsyncLogger::getTime() const
+    {
+        uint64_t time = mTime.load(std::memory_order_relaxed);
+        return time ? time : EZMQLogTime();
+    }
+
+    EZMQAsyncLogger::Ring *EZMQAsyncLogger::getRing()
+    {
+        static thread_local RingHolder holder;
+        if (!holder.ring)
+        {
+            holder.ring = std::make_shared<Ring>();
+            std::lock_guard<std::mutex> lock(mRingsLock);
+            mRings.push_back(holder.ring);
+        }
+        return holder.ring.get();
+    }
+
+    EZMQLogRecord *EZMQAsyncLogger::beginRecord(int level, const char *tag, Ring *&ring)
+    {
+        ring = getRing();
+        size_t tail = ring->tail.load(std::memory_order_relaxed);
+        size_t pending = tail - ring->head.load(std::memory_order_acquire);
+        if (pending >= EZMQ_LOG_RING_SIZE)
+        {
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        if (EZMQ_LOG_RING_SIZE / 2 == pending)
+        {
+            // Wake the background thread early on a burst
+            mWaitCond.notify_one();
+        }
+
+        EZMQLogRecord *record = &ring->records[tail % EZMQ_LOG_RING_SIZE];
+        record->level = level;
+        record->tag = tag;
+        record->argCount = 0;
+        record->stringSize = 0;
+        record->timestamp = getTime();
+        return record;
+    }
+
+    void EZMQAsyncLogger::commit(Ring *ring)
+    {
+        // Sequentially consistent with the fence in stop(). Either the final
+        // drain of stop() sees this record or this thread sees mRunning cleared
+        ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1);
+        if (!mRunning.load())
+        {
+            drain();
+        }
+    }
+
+    bool EZMQAsyncLogger::logv(int level, const char *tag, const char *format, va_list args)
+    {
+        if (!isRunning())
+        {
+            return false;
+        }
+
+        Ring *ring = nullptr;
+        EZMQLogRecord *record = beginRecord(level, tag, ring);
+        if (!record)
+        {
+            return true;
+        }
+
+        record->format = format;
+        if (!capture(*record, args))
+        {
+            // Conversion can not be deferred, format in place
+            va_list formatted;
+            va_copy(formatted, args);
+            vsnprintf(record->strings, EZMQ_LOG_RECORD_STRING_SIZE, format, formatted);
+            va_end(formatted);
+            record->format = "%s";
+            record->argCount = 1;
+            record->args[0].type = 's';
+            record->args[0].value.offset = 0;
+            record->stringSize = EZMQ_LOG_RECORD_STRING_SIZE;
+        }
+
+        commit(ring);
+        return true;
+    }
+
+    bool EZMQAsyncLogger::log(int level, const char *tag, const char *logStr)
+    {
+        if (!isRunning())
+        {
+            return false;
+        }
+
+        Ring *ring = nullptr;
+        EZMQLogRecord *record = beginRecord(level, tag, ring);
+        if (!record)
+        {
+            return true;
+        }
+
+        record->format = "%s";
+        addString(*record, logStr, EZMQ_LOG_RECORD_STRING_SIZE);
+        commit(ring);
+        return true;
+    }
+
+    void EZMQAsyncLogger::flush()
+    {
+        drain();
+    }
+
+    uint64_t EZMQAsyncLogger::getDroppedCount() const
+    {
+        return mDroppedCount;
+    }
+
+    bool EZMQAsyncLogger::capture(EZMQLogRecord &record, va_list args)
+    {
+        va_list local;
+        va_copy(local, args);
+        bool result = captureArgs(record, local);
+        va_end(local);
+        return result;
+    }
+
+    void EZMQAsyncLogger::render(const EZMQLogRecord &record, char *buffer, size_t size)
+    {
+        if (!buffer || 0 == size)
+        {
+            return;
+        }
+
+        size_t used = 0;
+        size_t argIndex = 0;
+        const char *p = record.format;
+        while (*p && used + 1 < size)
+        {
+            if ('%' != *p)
+            {
+                buffer[used++] = *p++;
+                continue;
+            }
+            p++;
+            if ('%' == *p)
+            {
+                buffer[used++] = *p++;
+                continue;
+            }
+
+            ConversionSpec spec;
+            p = parseSpec(p, spec);
+
+            // Rebuild the specification with star values resolved and
+            // length matching the stored argument
+            char specBuffer[MAX_SPEC_SIZE];
+            size_t specUsed = 0;
+            appendText(specBuffer, sizeof(specBuffer), specUsed, "%", 1);
+            appendText(specBuffer, sizeof(specBuffer), specUsed, spec.flags, spec.flagsSize);
+            if (spec.widthStar)
+            {
+                if (argIndex >= record.argCount)
+                {
+                    break;
+                }
+                appendFormatted(sizeof(specBuffer), specUsed,
+                    snprintf(specBuffer + specUsed, sizeof(specBuffer) - specUsed, "%d",
+                    static_cast<int>(record.args[argIndex++].value.i)));
+            }
+            else
+            {
+                appendText(specBuffer, sizeof(specBuffer), specUsed, spec.width, spec.widthSize);
+            }
+            if (spec.precisionStar)
+            {
+                if (argIndex >= record.argCount)
+                {
+                    break;
+                }
+                int precision = static_cast<int>(record.args[argIndex++].value.i);
+                if (precision >= 0)
+                {
+                    appendFormatted(sizeof(specBuffer), specUsed,
+                        snprintf(specBuffer + specUsed, sizeof(specBuffer) - specUsed, ".%d",
+                        precision));
+                }
+            }
+            else if (spec.hasPrecision)
+            {
+                appendText(specBuffer, sizeof(specBuffer), specUsed, ".", 1);
+                appendText(specBuffer, sizeof(specBuffer), specUsed, spec.precision,
+                    spec.precisionSize);
+            }
+
+            if (argIndex >= record.argCount)
+            {
+                break;
+            }
+            const EZMQLogArg &arg = record.args[argIndex++];
+            bool isInteger = 'd' == arg.type || 'i' == arg.type || 'u' == arg.type ||
+                'o' == arg.type || 'x' == arg.type || 'X' == arg.type;
+            if (isInteger)
+            {
+                appendText(specBuffer, sizeof(specBuffer), specUsed, "ll", 2);
+            }
+            appendText(specBuffer, sizeof(specBuffer), specUsed, &arg.type, 1);
+            specBuffer[specUsed] = '\0';
+
+            char *out = buffer + used;
+            size_t available = size - used;
+            int written = 0;
+            switch (arg.type)
+            {
+                case 'd':
+                case 'i':
+                    written = snprintf(out, available, specBuffer,
+                        static_cast<long long>(arg.value.i));
+                    break;
+                case 'u':
+                case 'o':
+                case 'x':
+                case 'X':
+                    written = snprintf(out, available, specBuffer,
+                        static_cast<unsigned long long>(arg.value.u));
+                    break;
+                case 'c':
+                    written = snprintf(out, available, specBuffer, static_cast<int>(arg.value.i));
+                    break;
+                case 's':
+                    written = snprintf(out, available, specBuffer, record.strings + arg.value.offset);
+                    break;
+                case 'p':
+                    written = snprintf(out, available, specBuffer, arg.value.p);
+                    break;
+                default:
+                    written = snprintf(out, available, specBuffer, arg.value.d);
+                    break;
+            }
+            appendFormatted(size, used, written);
+        }
+        buffer[used] = '\0';
+    }
+
+    void EZMQAsyncLogger::drain()
+    {
+        // Records are copied under the lock and written after it is released,
+        // the sink may log, flush or stop logging
+        std::vector<EZMQLogRecord> batch;
+        uint64_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> drainLock(mDrainLock);
+            std::vector<std::shared_ptr<Ring>> rings;
+            {
+                std::lock_guard<std::mutex> lock(mRingsLock);
+                rings = mRings;
+            }
+
+            for (auto &ring : rings)
+            {
+                // Owner thread has exited if closed, everything it wrote is visible
+                bool closed = ring->closed.load(std::memory_order_acquire);
+                size_t head = ring->head.load(std::memory_order_relaxed);
+                size_t tail = ring->tail.load(std::memory_order_acquire);
+                while (head != tail)
+                {
+                    batch.push_back(ring->records[head % EZMQ_LOG_RING_SIZE]);
+                    ring->head.store(++head, std::memory_order_release);
+                }
+
+                if (closed)
+                {
+                    std::lock_guard<std::mutex> lock(mRingsLock);
+                    for (auto it = mRings.begin(); it != mRings.end(); ++it)
+                    {
+                        if (*it == ring)
+                        {
+                            mRings.erase(it);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            uint64_t droppedCount = mDroppedCount;
+            dropped = droppedCount - mReportedDrops;
+            mReportedDrops = droppedCount;
+        }
+
+        char buffer[MAX_LOG_V_BUFFER_SIZE];
+        for (const auto &record : batch)
+        {
+            render(record, buffer, sizeof(buffer));
+            EZMQLogWrite(record.level, record.tag, record.timestamp, buffer);
+        }
+
+        if (0 != dropped)
+        {
+            snprintf(buffer, sizeof(buffer), "%llu log records dropped",
+                static_cast<unsigned long long>(dropped));
+            EZMQLogWrite(WARNING, "EZMQLogger", getTime(), buffer);
+        }
+    }
+
+    void EZMQAsyncLogger::run(uint64_t generation)
+    {
+        // A thread detached by stop() exits even if logging is started again
+        while (mRunning && generation == mGeneration)
+        {
+            mTime.store(EZMQLogTime(), std::memory_order_relaxed);
+            drain();
+            std::unique_lock<std::mutex> lock(mWaitLock);
+            mWaitCond.wait_for(lock, std::chrono::milliseconds(DRAIN_INTERVAL_MS),
+                [this] { return !mRunning; });
+        }
+    }
+}
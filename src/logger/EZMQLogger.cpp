@@ -34,12 +34,21 @@
 
 #include "string.h"
 
+#include <mutex>
+
 #include "EZMQLogger.h"
+#include "EZMQAsyncLogger.h"
 
 // log level
-static int g_level = DEBUG;
+int g_ezmqLogLevel = DEBUG;
 // private log messages are not logged unless they have been explicitly enabled by calling EZMQSetLogLevel().
 static bool g_hidePrivateLogEntries = true;
+// max entries per second of a log call site, 0 for no limit
+static std::atomic<uint32_t> g_rateLimit(EZMQ_DEFAULT_LOG_RATE_LIMIT);
+// log sink, NULL for stdout
+static EZMQLogSink g_sink = NULL;
+static void *g_sinkUserData = NULL;
+static std::mutex g_sinkLock;
 // Show 16 bytes, 2 chars/byte, spaces between bytes, null termination
 static const uint16_t LINE_BUFFER_SIZE = (16 * 2) + 16 + 1;
 
@@ -62,7 +71,7 @@ static bool AdjustAndVerifyLogLevel(int* level)
         localLevel &= ~EZMQ_LOG_PRIVATE_DATA;
     }
 
-    if (g_level > localLevel)
+    if (g_ezmqLogLevel > localLevel)
     {
         return false;
     }
@@ -107,9 +116,38 @@ void EZMQLogBuffer(int level, const char* tag, const uint8_t* buffer, size_t buf
     }
 }
 
+void EZMQSetAsyncLogging(bool enable)
+{
+    if (enable)
+    {
+        ezmq::EZMQAsyncLogger::getInstance().start();
+    }
+    else
+    {
+        ezmq::EZMQAsyncLogger::getInstance().stop();
+    }
+}
+
+void EZMQSetLogSink(EZMQLogSink sink, void *userData)
+{
+    std::lock_guard<std::mutex> lock(g_sinkLock);
+    g_sink = sink;
+    g_sinkUserData = userData;
+}
+
+void EZMQSetLogRateLimit(uint32_t entriesPerSecond)
+{
+    g_rateLimit = entriesPerSecond;
+}
+
+void EZMQFlushLog()
+{
+    ezmq::EZMQAsyncLogger::getInstance().flush();
+}
+
 void EZMQSetLogLevel(LogLevel level, bool hidePrivateLogEntries)
 {
-    g_level = level;
+    g_ezmqLogLevel = level;
     g_hidePrivateLogEntries = hidePrivateLogEntries;
 }
 void EZMQLogv(int level, const char * tag, const char * format, ...)
@@ -124,8 +162,20 @@ void EZMQLogv(int level, const char * tag, const char * format, ...)
         return;
     }
 
-    char buffer[MAX_LOG_V_BUFFER_SIZE] = {0};
     va_list args;
+    ezmq::EZMQAsyncLogger &asyncLogger = ezmq::EZMQAsyncLogger::getInstance();
+    if (asyncLogger.isRunning())
+    {
+        va_start(args, format);
+        bool queued = asyncLogger.logv(level, tag, format, args);
+        va_end(args);
+        if (queued)
+        {
+            return;
+        }
+    }
+
+    char buffer[MAX_LOG_V_BUFFER_SIZE] = {0};
     va_start(args, format);
     vsnprintf(buffer, sizeof buffer - 1, format, args);
     va_end(args);
@@ -143,36 +193,106 @@ void EZMQLog(int level, const char * tag, const char * logStr)
         return;
     }
 
-   int min = 0;
-   int sec = 0;
-   int ms = 0;
+    if (ezmq::EZMQAsyncLogger::getInstance().log(level, tag, logStr))
+    {
+        return;
+    }
+
+    EZMQLogWrite(level, tag, ezmq::EZMQAsyncLogger::getInstance().getTime(), logStr);
+}
+
+uint64_t EZMQLogTime()
+{
 #if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0
    struct timespec when = { .tv_sec = 0, .tv_nsec = 0 };
    clockid_t clk = CLOCK_REALTIME;
 #ifdef CLOCK_REALTIME_COARSE
    clk = CLOCK_REALTIME_COARSE;
 #endif
-   if (!clock_gettime(clk, &when))
+   if (clock_gettime(clk, &when))
    {
-       min = (when.tv_sec / 60) % 60;
-       sec = when.tv_sec % 60;
-       ms = when.tv_nsec / 1000000;
+       return 0;
    }
+   return (uint64_t)when.tv_sec * 1000 + when.tv_nsec / 1000000;
 #elif defined(_WIN32)
-   SYSTEMTIME systemTime = {0};
-   GetLocalTime(&systemTime);
-   min = (int)systemTime.wMinute;
-   sec = (int)systemTime.wSecond;
-   ms  = (int)systemTime.wMilliseconds;
+   FILETIME fileTime;
+   GetSystemTimeAsFileTime(&fileTime);
+   uint64_t intervals = ((uint64_t)fileTime.dwHighDateTime << 32) | fileTime.dwLowDateTime;
+   // 100ns intervals since 1601
+   return (intervals - 116444736000000000ULL) / 10000;
 #else
     struct timeval now;
-    if (!gettimeofday(&now, NULL))
+    if (gettimeofday(&now, NULL))
+    {
+        return 0;
+    }
+    return (uint64_t)now.tv_sec * 1000 + now.tv_usec / 1000;
+#endif
+}
+
+void EZMQLogWrite(int level, const char *tag, uint64_t timestamp, const char *logStr)
+{
+    EZMQLogSink sink = NULL;
+    void *userData = NULL;
+    {
+        std::lock_guard<std::mutex> lock(g_sinkLock);
+        sink = g_sink;
+        userData = g_sinkUserData;
+    }
+    // Called unlocked, the sink may log or replace itself
+    if (sink)
+    {
+        sink(level, tag, timestamp, logStr, userData);
+        return;
+    }
+
+    int min = (int)((timestamp / 60000) % 60);
+    int sec = (int)((timestamp / 1000) % 60);
+    int ms = (int)(timestamp % 1000);
+#if defined(_WIN32)
+    // Windows prints local time
+    uint64_t intervals = timestamp * 10000 + 116444736000000000ULL;
+    FILETIME fileTime;
+    fileTime.dwLowDateTime = (DWORD)intervals;
+    fileTime.dwHighDateTime = (DWORD)(intervals >> 32);
+    FILETIME localFileTime;
+    SYSTEMTIME systemTime = {0};
+    if (FileTimeToLocalFileTime(&fileTime, &localFileTime) &&
+        FileTimeToSystemTime(&localFileTime, &systemTime))
     {
-        min = (now.tv_sec / 60) % 60;
-        sec = now.tv_sec % 60;
-        ms = now.tv_usec * 1000;
+        min = (int)systemTime.wMinute;
+        sec = (int)systemTime.wSecond;
+        ms = (int)systemTime.wMilliseconds;
     }
 #endif
     printf("%02d:%02d.%03d %s: %s: %s\n", min, sec, ms, LEVEL[level], tag, logStr);
 }
 
+namespace ezmq
+{
+    bool EZMQLogRateLimiter::allow(uint32_t &suppressed)
+    {
+        uint32_t limit = g_rateLimit.load(std::memory_order_relaxed);
+        if (0 == limit)
+        {
+            suppressed = mSuppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Fixed one second windows, races only make the limit approximate
+        int64_t now = (int64_t)(EZMQAsyncLogger::getInstance().getTime() / 1000);
+        int64_t window = mWindow.load(std::memory_order_relaxed);
+        if (window != now && mWindow.compare_exchange_strong(window, now, std::memory_order_relaxed))
+        {
+            mCount.store(0, std::memory_order_relaxed);
+        }
+
+        if (mCount.fetch_add(1, std::memory_order_relaxed) < limit)
+        {
+            suppressed = mSuppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        mSuppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * Captures events from a publisher and trains zstd dictionary from them.
+ * Trained dictionary is used with EZMQ_COMPRESSION_ZSTD_DICT codec of publisher and
+ * subscribers.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+
+#include "EZMQAPI.h"
+#include "EZMQSubscriber.h"
+#include "EZMQCompression.h"
+#include "EZMQErrorCodes.h"
+#include "Event.pb.h"
+#include "EZMQMessage.h"
+#include "EZMQByteData.h"
+
+#define DEFAULT_SAMPLES 1000
+#define DEFAULT_DICTIONARY_SIZE (100 * 1024)
+
+using namespace std;
+using namespace ezmq;
+
+size_t gSampleCount = DEFAULT_SAMPLES;
+std::vector<std::string> gSamples;
+std::mutex gMutex;
+std::condition_variable gCV;
+
+void addSample(const EZMQMessage &event)
+{
+    std::string sample;
+    if(EZMQ_CONTENT_TYPE_PROTOBUF == event.getContentType())
+    {
+        const Event *protoEvent =  dynamic_cast<const Event*>(&event);
+        protoEvent->SerializeToString(&sample);
+    }
+    else if(EZMQ_CONTENT_TYPE_BYTEDATA == event.getContentType())
+    {
+        const EZMQByteData *byteData =  dynamic_cast<const EZMQByteData*>(&event);
+        sample.assign((const char *)byteData->getByteData(), byteData->getLength());
+    }
+
+    std::unique_lock<std::mutex> lock(gMutex);
+    if(gSamples.size() < gSampleCount)
+    {
+        gSamples.push_back(sample);
+        if(gSamples.size() == gSampleCount)
+        {
+            gCV.notify_all();
+        }
+    }
+}
+
+void printError()
+{
+    cout<<"\nRe-run the application as shown in below examples: "<<endl;
+    cout<<"\n  (1) For capturing events without topic: "<<endl;
+    cout<<"     ./dictionary_trainer -ip localhost -port 5562 -o events.dict"<<endl;
+    cout<<"\n  (2) For capturing events with topic: "<<endl;
+    cout<<"     ./dictionary_trainer -ip localhost -port 5562 -t topic1 -o events.dict"<<endl;
+    cout<<"\n  Optional arguments: "<<endl;
+    cout<<"     -n <number of events to capture> [default: "<<DEFAULT_SAMPLES<<"]"<<endl;
+    cout<<"     -size <maximum dictionary size in bytes> [default: "<<DEFAULT_DICTIONARY_SIZE<<"]"<<endl;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string ip;
+    int port = 5562;
+    std::string topic="";
+    std::string output;
+    size_t dictionarySize = DEFAULT_DICTIONARY_SIZE;
+    EZMQErrorCode result = EZMQ_ERROR;
+
+    int n = 1;
+    while (n + 1 < argc)
+    {
+        if (0 == strcmp(argv[n],"-ip"))
+        {
+            ip = argv[n + 1];
+        }
+        else if (0 == strcmp(argv[n],"-port"))
+        {
+            port = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-t"))
+        {
+            topic = argv[n + 1];
+        }
+        else if (0 == strcmp(argv[n],"-o"))
+        {
+            output = argv[n + 1];
+        }
+        else if (0 == strcmp(argv[n],"-n"))
+        {
+            gSampleCount = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-size"))
+        {
+            dictionarySize = atoi(argv[n + 1]);
+        }
+        else
+        {
+            printError();
+            return -1;
+        }
+        n = n + 2;
+    }
+    if(ip.empty() || output.empty() || n != argc || !gSampleCount)
+    {
+        printError();
+        return -1;
+    }
+
+    //Initialize EZMQ stack
+    EZMQAPI *obj = EZMQAPI::getInstance();
+    result = obj->initialize();
+    if(result != EZMQ_OK)
+    {
+        cout<<"Initialize API failed [result]: "<<result<<endl;
+        return -1;
+    }
+
+    EZMQSubscriber subscriber(ip, port, [](const EZMQMessage &event) { addSample(event); },
+        [](const std::string &/*topic*/, const EZMQMessage &event) { addSample(event); });
+    result = subscriber.start();
+    if(result != EZMQ_OK)
+    {
+        cout<<"Subscriber start failed [result]: "<<result<<endl;
+        return -1;
+    }
+    result = topic.empty() ? subscriber.subscribe() : subscriber.subscribe(topic);
+    if(result != EZMQ_OK)
+    {
+        cout<<"Subscribe failed [result]: "<<result<<endl;
+        return -1;
+    }
+
+    cout<<"Capturing "<<gSampleCount<<" events..."<<endl;
+    {
+        std::unique_lock<std::mutex> lock(gMutex);
+        gCV.wait(lock, [] { return gSamples.size() == gSampleCount; });
+    }
+    subscriber.stop();
+
+    std::string dictionary;
+    result = EZMQCompression::trainDictionary(gSamples, dictionarySize, dictionary);
+    if(result != EZMQ_OK)
+    {
+        cout<<"Dictionary training failed, EZMQ should be built with COMPRESSION=1"<<endl;
+        return -1;
+    }
+
+    std::ofstream file(output.c_str(), std::ios::binary);
+    file.write(dictionary.c_str(), dictionary.size());
+    if(!file)
+    {
+        cout<<"Failed to write: "<<output<<endl;
+        return -1;
+    }
+    EZMQCompressionDictionary trained(dictionary, 0);
+    cout<<"Dictionary [ID: "<<trained.getId()<<", size: "<<dictionary.size()<<"] written to "
+        <<output<<endl;
+    return 0;
+}
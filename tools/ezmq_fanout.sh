@@ -0,0 +1,15 @@
+#!/bin/bash
+# Fan-out scaling sweep: runs ezmq_perf in local mode for a list of subscriber
+# counts and prints one summary line per point.
+# Usage: ./ezmq_fanout.sh [subscriber counts] [extra ezmq_perf options]
+#   e.g. ./ezmq_fanout.sh "1 2 4 8 16" -topics 4 -n 10000 -procs 2
+
+PERF=${EZMQ_PERF:-./ezmq_perf}
+COUNTS=${1:-"1 2 4 8 16 32 64"}
+shift
+
+for subs in $COUNTS
+do
+    echo "### subscribers per process: $subs"
+    $PERF local -subs $subs "$@" | grep "\[Summary\]"
+done
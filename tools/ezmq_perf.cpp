@@ -0,0 +1,548 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+/**
+ * Throughput and latency benchmark of EZMQ publisher and subscriber, in the
+ * manner of local_thr/remote_thr of libzmq.
+ * Publisher sends ByteData messages of a given size round robin on a number of
+ * topics from a number of threads. Subscribers report message and byte rates,
+ * and end-to-end latency percentiles from publish timestamps.
+ * For fan-out scaling, subscribers can be spread over a number of processes
+ * and CPU time is reported per subscriber receive thread and per process.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "EZMQAPI.h"
+#include "EZMQPublisher.h"
+#include "EZMQSubscriber.h"
+#include "EZMQByteData.h"
+#include "EZMQErrorCodes.h"
+#include "EZMQLatencyHistogram.h"
+
+#define TOPIC_PREFIX "perf"
+
+using namespace std;
+using namespace ezmq;
+
+typedef std::chrono::steady_clock Clock;
+
+struct PerfOptions
+{
+    std::string mode;
+    std::string ip = "localhost";
+    int port = 5570;
+    size_t size = 64;
+    uint64_t count = 100000;
+    int topics = 1;
+    int threads = 1;
+    int subscribers = 1;
+    int processes = 1;
+    uint64_t rate = 0;
+    int delayMs = 1000;
+    int timeoutMs = 5000;
+};
+
+struct ReceiveStats
+{
+    std::atomic<uint64_t> received;
+    std::atomic<uint64_t> bytes;
+    std::atomic<int64_t> first;
+    std::atomic<int64_t> last;
+    std::atomic<bool> hasThreadClock;
+    clockid_t threadClock;
+    ReceiveStats() : received(0), bytes(0), first(0), last(0), hasThreadClock(false) {}
+};
+
+// Prefix of report lines, identifies subscriber process
+std::string gLabel;
+
+std::string getTopic(int index)
+{
+    return std::string(TOPIC_PREFIX) + "/" + std::to_string(index);
+}
+
+int64_t getNanoseconds(Clock::time_point time)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+double getSeconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+}
+
+double getProcessCpuSeconds()
+{
+    struct rusage usage;
+    if(0 != getrusage(RUSAGE_SELF, &usage))
+    {
+        return 0;
+    }
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+        (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+double getThreadCpuSeconds(const ReceiveStats &stats)
+{
+    struct timespec time;
+    if(!stats.hasThreadClock || 0 != clock_gettime(stats.threadClock, &time))
+    {
+        return 0;
+    }
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+void printRate(const char *label, uint64_t messages, uint64_t bytes, double seconds)
+{
+    if(seconds <= 0)
+    {
+        seconds = 1e-9;
+    }
+    cout<<label<<" "<<messages<<" messages, "<<bytes<<" bytes in "<<fixed<<setprecision(3)
+        <<seconds<<" s: "<<setprecision(0)<<messages / seconds<<" msg/s, "<<setprecision(2)
+        <<bytes / seconds / (1024 * 1024)<<" MB/s"<<endl;
+}
+
+void onMessage(ReceiveStats &stats, const EZMQMessage &event)
+{
+    int64_t now = getNanoseconds(Clock::now());
+    const EZMQByteData *byteData = dynamic_cast<const EZMQByteData*>(&event);
+    if(0 == stats.received)
+    {
+        stats.first = now;
+        // CPU clock of receive thread, read when reporting
+        if(0 == pthread_getcpuclockid(pthread_self(), &stats.threadClock))
+        {
+            stats.hasThreadClock = true;
+        }
+    }
+    stats.last = now;
+    stats.bytes += byteData ? byteData->getLength() : 0;
+    stats.received++;
+}
+
+void publishMessages(EZMQPublisher &publisher, const PerfOptions &options, int threadIndex,
+    uint64_t count)
+{
+    std::vector<uint8_t> payload(options.size, 0x5A);
+    EZMQByteData byteData(payload.data(), payload.size());
+    std::vector<std::string> topics;
+    for (int i = 0; i < options.topics; i++)
+    {
+        topics.push_back(getTopic(i));
+    }
+
+    // Pace each thread to its share of the rate
+    std::chrono::nanoseconds interval(0);
+    if(options.rate)
+    {
+        interval = std::chrono::nanoseconds(1000000000ULL * options.threads / options.rate);
+    }
+    Clock::time_point next = Clock::now();
+    for (uint64_t i = 0; i < count; i++)
+    {
+        if(options.rate)
+        {
+            std::this_thread::sleep_until(next);
+            next += interval;
+        }
+        publisher.publish(topics[(i + threadIndex) % topics.size()], byteData);
+    }
+}
+
+int runPublisher(const PerfOptions &options)
+{
+    EZMQPUBCallback callback;
+    EZMQPublisher publisher(options.port, &callback);
+    publisher.setSequenceNumbers(true);
+    publisher.setPublishTimestamps(true);
+    EZMQErrorCode result = publisher.start();
+    if(result != EZMQ_OK)
+    {
+        cout<<"Publisher start failed [result]: "<<result<<endl;
+        return -1;
+    }
+
+    // Give subscribers time to connect, messages before that are lost
+    std::this_thread::sleep_for(std::chrono::milliseconds(options.delayMs));
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < options.threads; i++)
+    {
+        uint64_t count = options.count / options.threads + (i < (int)(options.count % options.threads));
+        threads.push_back(std::thread(publishMessages, std::ref(publisher), std::cref(options), i,
+            count));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    Clock::time_point end = Clock::now();
+    printRate("Published", options.count, options.count * options.size, getSeconds(start, end));
+
+    // Let queued messages leave before socket is closed
+    std::this_thread::sleep_for(std::chrono::milliseconds(options.delayMs));
+    publisher.stop();
+    return 0;
+}
+
+struct PerfSubscriber
+{
+    ReceiveStats stats;
+    std::unique_ptr<EZMQSubscriber> subscriber;
+};
+
+int startSubscribers(const PerfOptions &options, std::vector<std::unique_ptr<PerfSubscriber>> &subscribers)
+{
+    for (int i = 0; i < options.subscribers; i++)
+    {
+        std::unique_ptr<PerfSubscriber> perfSubscriber(new PerfSubscriber());
+        ReceiveStats &stats = perfSubscriber->stats;
+        perfSubscriber->subscriber.reset(new EZMQSubscriber(options.ip, options.port,
+            [&stats](const EZMQMessage &event) { onMessage(stats, event); },
+            [&stats](const std::string &/*topic*/, const EZMQMessage &event) { onMessage(stats, event); }));
+        EZMQErrorCode result = perfSubscriber->subscriber->start();
+        if(result == EZMQ_OK)
+        {
+            result = perfSubscriber->subscriber->subscribe(TOPIC_PREFIX);
+        }
+        if(result != EZMQ_OK)
+        {
+            cout<<"Subscriber start failed [result]: "<<result<<endl;
+            return -1;
+        }
+        subscribers.push_back(std::move(perfSubscriber));
+    }
+    return 0;
+}
+
+void waitSubscribers(const PerfOptions &options, std::vector<std::unique_ptr<PerfSubscriber>> &subscribers)
+{
+    // Wait until all messages are received, or none is received for timeout
+    uint64_t lastTotal = 0;
+    Clock::time_point lastChange = Clock::now();
+    while(true)
+    {
+        uint64_t total = 0;
+        bool done = true;
+        for (auto &perfSubscriber : subscribers)
+        {
+            total += perfSubscriber->stats.received;
+            done = done && perfSubscriber->stats.received >= options.count;
+        }
+        if(done)
+        {
+            break;
+        }
+        if(total != lastTotal)
+        {
+            lastTotal = total;
+            lastChange = Clock::now();
+        }
+        else if(Clock::now() - lastChange > std::chrono::milliseconds(options.timeoutMs))
+        {
+            cout<<"Timed out waiting for messages"<<endl;
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+void reportSubscribers(const PerfOptions &options, std::vector<std::unique_ptr<PerfSubscriber>> &subscribers,
+    double cpuStart, Clock::time_point start)
+{
+    uint64_t totalReceived = 0;
+    uint64_t totalBytes = 0;
+    uint64_t totalLost = 0;
+    int64_t first = 0;
+    int64_t last = 0;
+    double minRate = 0;
+    double maxRate = 0;
+    for (size_t i = 0; i < subscribers.size(); i++)
+    {
+        ReceiveStats &stats = subscribers[i]->stats;
+        EZMQSubscriber &subscriber = *subscribers[i]->subscriber;
+        uint64_t received = stats.received;
+        uint64_t lost = received < options.count ? options.count - received : 0;
+        double seconds = (stats.last - stats.first) / 1e9;
+        cout<<gLabel<<"[Subscriber "<<i<<"] ";
+        printRate("Received", received, stats.bytes, seconds);
+        cout<<gLabel<<"[Subscriber "<<i<<"] Lost "<<lost<<" messages, "<<subscriber.getDroppedCount()
+            <<" detected from sequence gaps, receive thread CPU "<<setprecision(3)
+            <<getThreadCpuSeconds(stats)<<" s"<<endl;
+
+        double rate = seconds > 0 ? received / seconds : 0;
+        minRate = (0 == i || rate < minRate) ? rate : minRate;
+        maxRate = (0 == i || rate > maxRate) ? rate : maxRate;
+        totalReceived += received;
+        totalBytes += stats.bytes;
+        totalLost += lost;
+        if(received)
+        {
+            first = (0 == first || stats.first < first) ? stats.first.load() : first;
+            last = stats.last > last ? stats.last.load() : last;
+        }
+
+        EZMQLatencyHistogram latency;
+        if(EZMQ_OK != subscriber.getLatencyHistogram(latency))
+        {
+            continue;
+        }
+        cout<<gLabel<<"[Subscriber "<<i<<"] Latency [us]: min "<<setprecision(1)<<latency.getMin() / 1000.0
+            <<", mean "<<latency.getMean() / 1000.0
+            <<", p50 "<<latency.getPercentile(50) / 1000.0
+            <<", p90 "<<latency.getPercentile(90) / 1000.0
+            <<", p99 "<<latency.getPercentile(99) / 1000.0
+            <<", p99.9 "<<latency.getPercentile(99.9) / 1000.0
+            <<", max "<<latency.getMax() / 1000.0<<endl;
+    }
+
+    // Summary of all subscribers of this process, one line to collect scaling curves
+    double cpu = getProcessCpuSeconds() - cpuStart;
+    double wall = getSeconds(start, Clock::now());
+    double seconds = (last - first) / 1e9;
+    cout<<gLabel<<"[Summary] subscribers "<<subscribers.size()<<", topics "<<options.topics
+        <<", size "<<options.size<<", received "<<totalReceived<<", lost "<<totalLost
+        <<setprecision(0)<<", aggregate "<<(seconds > 0 ? totalReceived / seconds : 0)<<" msg/s"
+        <<setprecision(2)<<", "<<(seconds > 0 ? totalBytes / seconds / (1024 * 1024) : 0)<<" MB/s"
+        <<setprecision(0)<<", per subscriber min "<<minRate<<" max "<<maxRate<<" msg/s"
+        <<setprecision(3)<<", process CPU "<<cpu<<" s ("<<setprecision(1)
+        <<(wall > 0 ? 100 * cpu / wall : 0)<<"% of a core)"<<endl;
+}
+
+int runSubscriber(const PerfOptions &options)
+{
+    double cpuStart = getProcessCpuSeconds();
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<PerfSubscriber>> subscribers;
+    if(startSubscribers(options, subscribers))
+    {
+        return -1;
+    }
+    cout<<gLabel<<"Waiting for "<<options.count<<" messages..."<<endl;
+    waitSubscribers(options, subscribers);
+    reportSubscribers(options, subscribers, cpuStart, start);
+    for (auto &perfSubscriber : subscribers)
+    {
+        perfSubscriber->subscriber->stop();
+    }
+    return 0;
+}
+
+int runLocal(const PerfOptions &options)
+{
+    double cpuStart = getProcessCpuSeconds();
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<PerfSubscriber>> subscribers;
+    if(startSubscribers(options, subscribers))
+    {
+        return -1;
+    }
+    int result = runPublisher(options);
+    if(0 == result)
+    {
+        waitSubscribers(options, subscribers);
+        reportSubscribers(options, subscribers, cpuStart, start);
+    }
+    for (auto &perfSubscriber : subscribers)
+    {
+        perfSubscriber->subscriber->stop();
+    }
+    return result;
+}
+
+int initialize()
+{
+    //Initialize EZMQ stack
+    EZMQErrorCode result = EZMQAPI::getInstance()->initialize();
+    if(result != EZMQ_OK)
+    {
+        cout<<"Initialize API failed [result]: "<<result<<endl;
+        return -1;
+    }
+    return 0;
+}
+
+int runProcesses(const PerfOptions &options)
+{
+    // Processes are forked before ZMQ context is created, a context must not cross fork
+    std::vector<pid_t> children;
+    for (int i = 0; i < options.processes; i++)
+    {
+        pid_t pid = fork();
+        if(0 == pid)
+        {
+            gLabel = "[Process " + std::to_string(i) + "]";
+            _exit(initialize() ? 1 : (runSubscriber(options) ? 1 : 0));
+        }
+        if(pid < 0)
+        {
+            cout<<"Fork failed"<<endl;
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    int result = 0;
+    if("local" == options.mode)
+    {
+        result = initialize() ? -1 : runPublisher(options);
+    }
+    for (pid_t child : children)
+    {
+        int status = 0;
+        waitpid(child, &status, 0);
+        if(!WIFEXITED(status) || 0 != WEXITSTATUS(status))
+        {
+            result = -1;
+        }
+    }
+    return result;
+}
+
+void printError()
+{
+    cout<<"\nRe-run the application as shown in below examples: "<<endl;
+    cout<<"\n  (1) Subscriber, started first: "<<endl;
+    cout<<"     ./ezmq_perf sub -ip localhost -port 5570 -n 100000"<<endl;
+    cout<<"\n  (2) Publisher: "<<endl;
+    cout<<"     ./ezmq_perf pub -port 5570 -n 100000 -size 64"<<endl;
+    cout<<"\n  (3) Publisher and subscriber in one process over TCP loopback: "<<endl;
+    cout<<"     ./ezmq_perf local -port 5570 -n 100000 -size 64"<<endl;
+    cout<<"\n  Optional arguments: "<<endl;
+    cout<<"     -size <message size in bytes> [default: 64]"<<endl;
+    cout<<"     -topics <number of topics> [default: 1]"<<endl;
+    cout<<"     -threads <number of publishing threads> [default: 1]"<<endl;
+    cout<<"     -subs <number of subscribers per process> [default: 1]"<<endl;
+    cout<<"     -procs <number of subscriber processes, sub and local modes> [default: 1]"<<endl;
+    cout<<"     -rate <messages per second, 0 for max> [default: 0]"<<endl;
+    cout<<"     -delay <ms to wait for subscribers before and after publishing> [default: 1000]"<<endl;
+    cout<<"     -timeout <ms without message to stop subscriber> [default: 5000]"<<endl;
+}
+
+int main(int argc, char* argv[])
+{
+    PerfOptions options;
+    if(argc < 2)
+    {
+        printError();
+        return -1;
+    }
+    options.mode = argv[1];
+
+    int n = 2;
+    while (n + 1 < argc)
+    {
+        if (0 == strcmp(argv[n],"-ip"))
+        {
+            options.ip = argv[n + 1];
+        }
+        else if (0 == strcmp(argv[n],"-port"))
+        {
+            options.port = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-n"))
+        {
+            options.count = strtoull(argv[n + 1], NULL, 10);
+        }
+        else if (0 == strcmp(argv[n],"-size"))
+        {
+            options.size = strtoull(argv[n + 1], NULL, 10);
+        }
+        else if (0 == strcmp(argv[n],"-topics"))
+        {
+            options.topics = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-threads"))
+        {
+            options.threads = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-subs"))
+        {
+            options.subscribers = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-procs"))
+        {
+            options.processes = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-rate"))
+        {
+            options.rate = strtoull(argv[n + 1], NULL, 10);
+        }
+        else if (0 == strcmp(argv[n],"-delay"))
+        {
+            options.delayMs = atoi(argv[n + 1]);
+        }
+        else if (0 == strcmp(argv[n],"-timeout"))
+        {
+            options.timeoutMs = atoi(argv[n + 1]);
+        }
+        else
+        {
+            printError();
+            return -1;
+        }
+        n = n + 2;
+    }
+    if(n != argc || !options.count || !options.size || options.topics < 1 ||
+        options.threads < 1 || options.subscribers < 1 || options.processes < 1)
+    {
+        printError();
+        return -1;
+    }
+
+    bool isSubscriberMode = "sub" == options.mode || "local" == options.mode;
+    if(isSubscriberMode && options.processes > 1)
+    {
+        return runProcesses(options);
+    }
+    if(initialize())
+    {
+        return -1;
+    }
+
+    if("pub" == options.mode)
+    {
+        return runPublisher(options);
+    }
+    else if("sub" == options.mode)
+    {
+        return runSubscriber(options);
+    }
+    else if("local" == options.mode)
+    {
+        return runLocal(options);
+    }
+    printError();
+    return -1;
+}
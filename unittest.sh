@@ -1,5 +1,6 @@
 #!/bin/bash
-./build_auto.sh --target_arch=x86_64
+# compression codec tests run only in a build with compression
+./build_auto.sh --target_arch=x86_64 --with_compression=true
 
 cd out/linux/x86_64/release/unittests
 
@@ -18,3 +19,35 @@ cd out/linux/x86_64/release/unittests
 #ezmq_exception_test
 ./ezmq_exception_test
 
+#ezmq_topicTrie_test
+./ezmq_topicTrie_test
+
+#ezmq_compression_test
+./ezmq_compression_test
+
+#ezmq_jsonData_test
+./ezmq_jsonData_test
+
+#ezmq_eventBatch_test
+./ezmq_eventBatch_test
+
+#ezmq_segmentedByteData_test
+./ezmq_segmentedByteData_test
+
+#ezmq_latencyHistogram_test
+./ezmq_latencyHistogram_test
+
+#ezmq_header_test
+./ezmq_header_test
+
+#ezmq_metrics_test
+./ezmq_metrics_test
+
+#ezmq_asyncLogger_test
+./ezmq_asyncLogger_test
+
+#ezmq_logger_test
+./ezmq_logger_test
+
+#ezmq_tracer_test
+./ezmq_tracer_test
@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <chrono>
+#include <string>
+
+#include "EZMQAsyncLogger.h"
+#include "EZMQLogger.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQAsyncLoggerTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        EZMQSetAsyncLogging(false);
+        TestWithMock::TearDown();
+    }
+
+    // Render through capture and through vsnprintf
+    bool format(std::string &deferred, std::string &expected, const char *fmt, ...)
+    {
+        char buffer[MAX_LOG_V_BUFFER_SIZE];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buffer, sizeof(buffer), fmt, args);
+        va_end(args);
+        expected = buffer;
+
+        EZMQLogRecord record;
+        record.format = fmt;
+        va_start(args, fmt);
+        bool result = EZMQAsyncLogger::capture(record, args);
+        va_end(args);
+        if (result)
+        {
+            EZMQAsyncLogger::render(record, buffer, sizeof(buffer));
+            deferred = buffer;
+        }
+        return result;
+    }
+};
+
+TEST_F(EZMQAsyncLoggerTest, renderIntegers)
+{
+    std::string deferred;
+    std::string expected;
+    EXPECT_TRUE(format(deferred, expected, "%d %i %u %x %X %o", -7, 42, 4000000000u, 255u, 0xabcu, 8u));
+    EXPECT_EQ(expected, deferred);
+    EXPECT_TRUE(format(deferred, expected, "%hhx %hd %ld %lld %zu %jd %td", 300, 70000, -1L,
+        1LL << 40, (size_t)7, (intmax_t)-9, (ptrdiff_t)3));
+    EXPECT_EQ(expected, deferred);
+    EXPECT_TRUE(format(deferred, expected, "%+05d|%-6u|%#x|%c|100%%", 12, 3u, 16u, 'z'));
+    EXPECT_EQ(expected, deferred);
+}
+
+TEST_F(EZMQAsyncLoggerTest, renderStarWidthAndPrecision)
+{
+    std::string deferred;
+    std::string expected;
+    EXPECT_TRUE(format(deferred, expected, "[%*d] [%-*d] [%.*f] [%.*s]", 6, 42, 4, 1, 2, 3.14159, 3, "abcdef"));
+    EXPECT_EQ(expected, deferred);
+    EXPECT_TRUE(format(deferred, expected, "[%*d] [%.*f]", -5, 9, -1, 2.5));
+    EXPECT_EQ(expected, deferred);
+}
+
+TEST_F(EZMQAsyncLoggerTest, renderFloatsPointersAndStrings)
+{
+    std::string deferred;
+    std::string expected;
+    EXPECT_TRUE(format(deferred, expected, "%f %08.3e %G %a %p", 1.5, 1234.5, 0.0001, 0.25, (void *)&deferred));
+    EXPECT_EQ(expected, deferred);
+    EXPECT_TRUE(format(deferred, expected, "%s: %-8s| %.2s", "topic", "ab", "xyz"));
+    EXPECT_EQ(expected, deferred);
+}
+
+TEST_F(EZMQAsyncLoggerTest, renderTruncatesLongString)
+{
+    std::string deferred;
+    std::string expected;
+    std::string longString(EZMQ_LOG_RECORD_STRING_SIZE * 2, 'a');
+    EXPECT_TRUE(format(deferred, expected, "%s", longString.c_str()));
+    EXPECT_EQ(std::string(EZMQ_LOG_RECORD_STRING_SIZE - 1, 'a'), deferred);
+}
+
+TEST_F(EZMQAsyncLoggerTest, captureUnsupported)
+{
+    std::string deferred;
+    std::string expected;
+    EXPECT_FALSE(format(deferred, expected, "%Lf", (long double)1.5));
+    EXPECT_FALSE(format(deferred, expected, "%ls", L"wide"));
+    EXPECT_FALSE(format(deferred, expected, "%d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST_F(EZMQAsyncLoggerTest, startStop)
+{
+    EZMQAsyncLogger &logger = EZMQAsyncLogger::getInstance();
+    EXPECT_FALSE(logger.isRunning());
+    EXPECT_FALSE(logger.log(INFO, "EZMQAsyncLoggerTest", "not queued"));
+
+    EZMQSetAsyncLogging(true);
+    EXPECT_TRUE(logger.isRunning());
+    EXPECT_TRUE(logger.log(INFO, "EZMQAsyncLoggerTest", "queued"));
+    EZMQFlushLog();
+
+    EZMQSetAsyncLogging(false);
+    EXPECT_FALSE(logger.isRunning());
+}
+
+TEST_F(EZMQAsyncLoggerTest, logFromThreads)
+{
+    EZMQSetAsyncLogging(true);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.push_back(std::thread([i]
+        {
+            for (int j = 0; j < 100; j++)
+            {
+                EZMQLogv(INFO, "EZMQAsyncLoggerTest", "thread %d record %d", i, j);
+            }
+        }));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    EZMQFlushLog();
+    EZMQSetAsyncLogging(false);
+}
+
+static void countRecord(int level, const char *tag, uint64_t timestamp, const char *logStr,
+    void *userData)
+{
+    UNUSED(level);
+    UNUSED(timestamp);
+    UNUSED(logStr);
+    if (0 == strcmp("EZMQAsyncLoggerTest", tag))
+    {
+        static_cast<std::atomic<int> *>(userData)->fetch_add(1);
+    }
+}
+
+TEST_F(EZMQAsyncLoggerTest, stopWhileLogging)
+{
+    EZMQAsyncLogger &logger = EZMQAsyncLogger::getInstance();
+    std::atomic<int> written(0);
+    uint64_t dropped = logger.getDroppedCount();
+    EZMQSetLogSink(countRecord, &written);
+    EZMQSetAsyncLogging(true);
+    EXPECT_NE(0u, logger.getTime());
+
+    // Records racing with stop() are written either way
+    std::atomic<int> handled(0);
+    std::thread producer([&logger, &handled]
+    {
+        for (int i = 0; i < 2000; i++)
+        {
+            if (!logger.log(INFO, "EZMQAsyncLoggerTest", "racing stop"))
+            {
+                break;
+            }
+            handled++;
+        }
+    });
+    EZMQSetAsyncLogging(false);
+    producer.join();
+    EZMQSetLogSink(NULL, NULL);
+
+    EXPECT_EQ(handled.load(), written.load() + (int)(logger.getDroppedCount() - dropped));
+    EXPECT_NE(0u, logger.getTime());
+}
+
+static void flushingSink(int level, const char *tag, uint64_t timestamp, const char *logStr,
+    void *userData)
+{
+    countRecord(level, tag, timestamp, logStr, userData);
+    EZMQFlushLog();
+}
+
+static void stoppingSink(int level, const char *tag, uint64_t timestamp, const char *logStr,
+    void *userData)
+{
+    countRecord(level, tag, timestamp, logStr, userData);
+    EZMQSetAsyncLogging(false);
+}
+
+TEST_F(EZMQAsyncLoggerTest, sinkFlushes)
+{
+    std::atomic<int> written(0);
+    EZMQSetLogSink(flushingSink, &written);
+    EZMQSetAsyncLogging(true);
+    EZMQLog(INFO, "EZMQAsyncLoggerTest", "flushed by sink");
+    EZMQLog(INFO, "EZMQAsyncLoggerTest", "flushed by sink");
+    EZMQFlushLog();
+    EZMQSetAsyncLogging(false);
+    EZMQSetLogSink(NULL, NULL);
+    EXPECT_EQ(2, written.load());
+}
+
+TEST_F(EZMQAsyncLoggerTest, sinkStopsLogging)
+{
+    EZMQAsyncLogger &logger = EZMQAsyncLogger::getInstance();
+    std::atomic<int> written(0);
+    EZMQSetLogSink(stoppingSink, &written);
+    EZMQSetAsyncLogging(true);
+    EZMQLog(INFO, "EZMQAsyncLoggerTest", "stops logging");
+    for (int i = 0; i < 500 && logger.isRunning(); i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_FALSE(logger.isRunning());
+    EXPECT_EQ(1, written.load());
+
+    // Logging can be started again
+    EZMQSetLogSink(countRecord, &written);
+    EZMQSetAsyncLogging(true);
+    EZMQLog(INFO, "EZMQAsyncLoggerTest", "restarted");
+    EZMQSetAsyncLogging(false);
+    EZMQSetLogSink(NULL, NULL);
+    EXPECT_EQ(2, written.load());
+}
@@ -16,6 +16,7 @@
  *******************************************************************************/
 
 #include "EZMQByteData.h"
+#include "EZMQOwnedByteData.h"
 #include "UnitTestHelper.h"
 
 using namespace ezmq;
@@ -108,3 +109,54 @@ TEST_F(EZMQByteDataTest, setInvalidContentType)
     }
 }
 
+
+TEST_F(EZMQByteDataTest, ownedByteDataMessage)
+{
+    // small messages are stored inside zmq message itself
+    const char *payloads[] = {"small", "large payload which is allocated by zmq outside the message"};
+    for (const char *payload : payloads)
+    {
+        zmq::message_t message(payload, strlen(payload));
+        EZMQOwnedByteData byteData(std::move(message));
+        EXPECT_EQ(0u, message.size());
+        EXPECT_EQ(EZMQ_CONTENT_TYPE_BYTEDATA, byteData.getContentType());
+        ASSERT_EQ(strlen(payload), byteData.getLength());
+        EXPECT_EQ(0, memcmp(payload, byteData.getByteData(), byteData.getLength()));
+    }
+}
+
+TEST_F(EZMQByteDataTest, ownedByteDataMove)
+{
+    EZMQOwnedByteData byteData(std::string("payload"));
+    const uint8_t *data = byteData.getByteData();
+
+    EZMQOwnedByteData moved(std::move(byteData));
+    EXPECT_EQ(data, moved.getByteData());
+    EXPECT_EQ(7u, moved.getLength());
+    EXPECT_EQ(NULL, byteData.getByteData());
+    EXPECT_EQ(0u, byteData.getLength());
+
+    byteData = std::move(moved);
+    EXPECT_EQ(data, byteData.getByteData());
+    EXPECT_EQ(NULL, moved.getByteData());
+}
+
+TEST_F(EZMQByteDataTest, ownedByteDataShare)
+{
+    EZMQOwnedByteData shared;
+    {
+        EZMQOwnedByteData byteData(std::string("payload"));
+        byteData.setSchemaId(6);
+        shared = byteData.share();
+        EXPECT_EQ(byteData.getByteData(), shared.getByteData());
+    }
+    EXPECT_EQ(6u, shared.getSchemaId());
+    ASSERT_EQ(7u, shared.getLength());
+    EXPECT_EQ(0, memcmp("payload", shared.getByteData(), shared.getLength()));
+
+    char byteArray[] = { 0x40, 0x05, 0x10, 0x11, 0x12 };
+    EXPECT_EQ(EZMQ_ERROR, shared.setByteData(NULL, sizeof(byteArray)));
+    EXPECT_EQ(EZMQ_OK, shared.setByteData((uint8_t *) byteArray, sizeof(byteArray)));
+    EXPECT_NE((uint8_t *) byteArray, shared.getByteData());
+    EXPECT_EQ(0, memcmp(byteArray, shared.getByteData(), sizeof(byteArray)));
+}
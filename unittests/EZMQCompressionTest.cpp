@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQCompression.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQCompressionTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        // repetitive payload, similar to serialized events
+        for (int i = 0; i < 100; i++)
+        {
+            mData += "device/reading/temperature:" + std::to_string(i % 10) + ";";
+        }
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+
+    void roundTrip(EZMQCompressionCodec codec, int level)
+    {
+        std::string compressed;
+        std::string decompressed;
+        EXPECT_EQ(EZMQ_OK, EZMQCompression::compress(codec, level, mData.c_str(), mData.size(),
+            compressed));
+        EXPECT_LT(compressed.size(), mData.size());
+        EXPECT_EQ(EZMQ_OK, EZMQCompression::decompress(codec, compressed.c_str(),
+            compressed.size(), decompressed));
+        EXPECT_EQ(mData, decompressed);
+    }
+
+    std::string mData;
+};
+
+TEST_F(EZMQCompressionTest, noCompression)
+{
+    std::string output;
+    EXPECT_TRUE(EZMQCompression::isSupported(EZMQ_COMPRESSION_NONE));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::compress(EZMQ_COMPRESSION_NONE, 0, mData.c_str(),
+        mData.size(), output));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_NONE, mData.c_str(),
+        mData.size(), output));
+}
+
+// Codec tests need a build with COMPRESSION=1
+#ifdef COMPRESSION_ENABLED
+TEST_F(EZMQCompressionTest, lz4)
+{
+    EXPECT_TRUE(EZMQCompression::isSupported(EZMQ_COMPRESSION_LZ4));
+    roundTrip(EZMQ_COMPRESSION_LZ4, 0);
+    roundTrip(EZMQ_COMPRESSION_LZ4, 9);
+}
+
+TEST_F(EZMQCompressionTest, zstd)
+{
+    EXPECT_TRUE(EZMQCompression::isSupported(EZMQ_COMPRESSION_ZSTD));
+    roundTrip(EZMQ_COMPRESSION_ZSTD, 0);
+    roundTrip(EZMQ_COMPRESSION_ZSTD, 19);
+}
+
+TEST_F(EZMQCompressionTest, corruptedPayload)
+{
+    std::string compressed;
+    std::string decompressed;
+    EXPECT_EQ(EZMQ_OK, EZMQCompression::compress(EZMQ_COMPRESSION_ZSTD, 0, mData.c_str(),
+        mData.size(), compressed));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_ZSTD, compressed.c_str(),
+        2, decompressed));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_ZSTD, compressed.c_str(),
+        compressed.size() / 2, decompressed));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_LZ4, compressed.c_str(),
+        compressed.size(), decompressed));
+}
+
+TEST_F(EZMQCompressionTest, dictionary)
+{
+    std::vector<std::string> samples;
+    for (int i = 0; i < 1000; i++)
+    {
+        samples.push_back("{device:sensor-" + std::to_string(i % 50) + ",reading:temperature,value:" +
+            std::to_string(i * 7 % 1000) + ",origin:" + std::to_string(1500000000 + i * 13) + "}");
+    }
+    std::string trained;
+    ASSERT_EQ(EZMQ_OK, EZMQCompression::trainDictionary(samples, 4096, trained));
+    EZMQCompressionDictionary dictionary(trained, 0);
+    EXPECT_NE(0u, dictionary.getId());
+
+    std::string &sample = samples[3];
+    std::string withDictionary;
+    std::string withoutDictionary;
+    std::string decompressed;
+    EXPECT_EQ(EZMQ_OK, EZMQCompression::compress(dictionary, sample.c_str(), sample.size(),
+        withDictionary));
+    EXPECT_EQ(EZMQ_OK, EZMQCompression::compress(EZMQ_COMPRESSION_ZSTD, 0, sample.c_str(),
+        sample.size(), withoutDictionary));
+    EXPECT_LT(withDictionary.size(), withoutDictionary.size());
+    EXPECT_EQ(dictionary.getId(), EZMQCompression::getDictionaryId(withDictionary.c_str(),
+        withDictionary.size()));
+    EXPECT_EQ(0u, EZMQCompression::getDictionaryId(withoutDictionary.c_str(),
+        withoutDictionary.size()));
+    EXPECT_EQ(EZMQ_OK, EZMQCompression::decompress(dictionary, withDictionary.c_str(),
+        withDictionary.size(), decompressed));
+    EXPECT_EQ(sample, decompressed);
+}
+
+TEST_F(EZMQCompressionTest, maliciousSizePrefix)
+{
+    // 64MB claimed by a one byte payload
+    std::string payload("\x04\x00\x00\x00\x00", 5);
+    std::string output;
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_LZ4, payload.c_str(),
+        payload.size(), output));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_ZSTD, payload.c_str(),
+        payload.size(), output));
+    EXPECT_LT(output.capacity(), 1024u * 1024u);
+
+    // size prefix not matching content size of zstd frame
+    std::string compressed;
+    ASSERT_EQ(EZMQ_OK, EZMQCompression::compress(EZMQ_COMPRESSION_ZSTD, 0, mData.c_str(),
+        mData.size(), compressed));
+    compressed[3] = (char)(compressed[3] + 1);
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_ZSTD, compressed.c_str(),
+        compressed.size(), output));
+
+    // size prefix beyond max ratio of LZ4
+    ASSERT_EQ(EZMQ_OK, EZMQCompression::compress(EZMQ_COMPRESSION_LZ4, 0, mData.c_str(),
+        mData.size(), compressed));
+    compressed[0] = 0x01;
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::decompress(EZMQ_COMPRESSION_LZ4, compressed.c_str(),
+        compressed.size(), output));
+}
+#else
+TEST_F(EZMQCompressionTest, unsupportedCodecs)
+{
+    std::vector<std::string> samples(100, mData);
+    std::string output;
+    EXPECT_FALSE(EZMQCompression::isSupported(EZMQ_COMPRESSION_LZ4));
+    EXPECT_FALSE(EZMQCompression::isSupported(EZMQ_COMPRESSION_ZSTD));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::compress(EZMQ_COMPRESSION_LZ4, 0, mData.c_str(),
+        mData.size(), output));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::compress(EZMQ_COMPRESSION_ZSTD, 0, mData.c_str(),
+        mData.size(), output));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::trainDictionary(samples, 4096, output));
+}
+#endif // COMPRESSION_ENABLED
+
+TEST_F(EZMQCompressionTest, invalidDictionary)
+{
+    EZMQCompressionDictionary dictionary(mData, 0);
+    std::string output;
+    EXPECT_EQ(0u, dictionary.getId());
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::compress(dictionary, mData.c_str(), mData.size(), output));
+    EXPECT_EQ(EZMQ_ERROR, EZMQCompression::compress(EZMQ_COMPRESSION_ZSTD_DICT, 0, mData.c_str(),
+        mData.size(), output));
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQEventBatch.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQEventBatchTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+
+    ezmq::Event getLargeEvent(int count)
+    {
+        ezmq::Event event = getProtoBufEvent();
+        event.clear_reading();
+        for (int i = 0; i < count; i++)
+        {
+            ezmq::Reading *reading = event.add_reading();
+            reading->set_id("id" + std::to_string(i));
+            reading->set_name("reading" + std::to_string(i % 4));
+            reading->set_value(std::to_string(i % 100));
+            reading->set_device("device");
+            reading->set_created(1500000000000LL + i * 10);
+            reading->set_modified(1500000000000LL + i * 10);
+            reading->set_origin(1500000000000LL + i * 10 - 5);
+            reading->set_pushed(0);
+        }
+        return event;
+    }
+};
+
+TEST_F(EZMQEventBatchTest, constructEventBatch)
+{
+    EZMQEventBatch batch;
+    ezmq::Event event;
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_EVENT_BATCH, batch.getContentType());
+    EXPECT_TRUE(batch.getData().empty());
+    EXPECT_EQ(EZMQ_ERROR, batch.getEvent(event));
+}
+
+TEST_F(EZMQEventBatchTest, roundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    event.set_created(-9223372036854775807LL - 1);
+    event.set_modified(9223372036854775807LL);
+    EZMQEventBatch batch;
+    EXPECT_EQ(EZMQ_OK, batch.setEvent(event));
+
+    ezmq::Event decoded;
+    EXPECT_EQ(EZMQ_OK, batch.getEvent(decoded));
+    EXPECT_EQ(event.SerializeAsString(), decoded.SerializeAsString());
+}
+
+TEST_F(EZMQEventBatchTest, largeEvent)
+{
+    ezmq::Event event = getLargeEvent(1000);
+    EZMQEventBatch batch;
+    EXPECT_EQ(EZMQ_OK, batch.setEvent(event));
+    EXPECT_LT(batch.getData().size() * 2, event.SerializeAsString().size());
+
+    ezmq::Event decoded;
+    EXPECT_EQ(EZMQ_OK, batch.getEvent(decoded));
+    EXPECT_EQ(event.SerializeAsString(), decoded.SerializeAsString());
+}
+
+TEST_F(EZMQEventBatchTest, typedReading)
+{
+    ezmq::Event event = getTypedEvent();
+    event.mutable_reading(1)->set_int_value(0);
+    event.mutable_reading(1)->add_double_values(-1.5);
+    EZMQEventBatch batch;
+    EXPECT_EQ(EZMQ_OK, batch.setEvent(event));
+
+    ezmq::Event decoded;
+    EXPECT_EQ(EZMQ_OK, batch.getEvent(decoded));
+    EXPECT_EQ(event.SerializeAsString(), decoded.SerializeAsString());
+    EXPECT_TRUE(decoded.reading(1).has_int_value());
+    EXPECT_FALSE(decoded.reading(1).has_binary_value());
+
+    // every truncation of typed columns is detected
+    std::string data = batch.getData();
+    for (size_t size = 0; size < data.size(); size++)
+    {
+        batch.setData(data.substr(0, size));
+        EXPECT_EQ(EZMQ_ERROR, batch.getEvent(decoded));
+    }
+}
+
+TEST_F(EZMQEventBatchTest, malformedData)
+{
+    EZMQEventBatch batch;
+    EXPECT_EQ(EZMQ_OK, batch.setEvent(getLargeEvent(10)));
+    std::string data = batch.getData();
+
+    ezmq::Event event;
+    for (size_t size = 0; size < data.size(); size++)
+    {
+        batch.setData(data.substr(0, size));
+        EXPECT_EQ(EZMQ_ERROR, batch.getEvent(event));
+    }
+    batch.setData(data + '\0');
+    EXPECT_EQ(EZMQ_ERROR, batch.getEvent(event));
+    data[0] = 2;
+    batch.setData(data);
+    EXPECT_EQ(EZMQ_ERROR, batch.getEvent(event));
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQHeader.h"
+#include "EZMQMessage.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQHeaderTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+
+    std::vector<unsigned char> encode(const EZMQHeader &header)
+    {
+        std::vector<unsigned char> frame(header.getSize());
+        header.write(&frame[0]);
+        return frame;
+    }
+};
+
+TEST_F(EZMQHeaderTest, version1)
+{
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_JSON);
+    header.setCompressionCodec(EZMQ_COMPRESSION_ZSTD);
+    std::vector<unsigned char> frame = encode(header);
+    ASSERT_EQ(1u, frame.size());
+    EXPECT_EQ(0x66, frame[0]);
+
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(&frame[0], frame.size()));
+    EXPECT_EQ(1, decoded.getVersion());
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_JSON, decoded.getContentType());
+    EXPECT_EQ(EZMQ_COMPRESSION_ZSTD, decoded.getCompressionCodec());
+    EXPECT_FALSE(decoded.hasSequence());
+    EXPECT_FALSE(decoded.hasTimestamp());
+    EXPECT_FALSE(decoded.hasSchemaId());
+}
+
+TEST_F(EZMQHeaderTest, version2)
+{
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_BYTEDATA);
+    header.setSequence(0xdeadbeef, 0x0102030405060708ULL);
+    header.setTimestamp(1234567890123456789ULL);
+    header.setSchemaId(7);
+    std::vector<unsigned char> frame = encode(header);
+    EXPECT_EQ(1u + 14u + 10u + 6u, frame.size());
+
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(&frame[0], frame.size()));
+    EXPECT_EQ(2, decoded.getVersion());
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_BYTEDATA, decoded.getContentType());
+    EXPECT_EQ(EZMQ_COMPRESSION_NONE, decoded.getCompressionCodec());
+    EXPECT_TRUE(decoded.hasSequence());
+    EXPECT_EQ(0xdeadbeefu, decoded.getPublisherId());
+    EXPECT_EQ(0x0102030405060708ULL, decoded.getSequence());
+    EXPECT_TRUE(decoded.hasTimestamp());
+    EXPECT_EQ(1234567890123456789ULL, decoded.getTimestamp());
+    EXPECT_TRUE(decoded.hasSchemaId());
+    EXPECT_EQ(7u, decoded.getSchemaId());
+}
+
+TEST_F(EZMQHeaderTest, rewriteInPlace)
+{
+    EZMQHeader header;
+    header.setSequence(1, 0);
+    std::vector<unsigned char> frame = encode(header);
+    header.setSequence(1, 42);
+    header.write(&frame[0]);
+
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(&frame[0], frame.size()));
+    EXPECT_EQ(42u, decoded.getSequence());
+}
+
+TEST_F(EZMQHeaderTest, unknownExtension)
+{
+    unsigned char frame[] = {0x08, 0x7f, 0x02, 0xaa, 0xbb, EZMQ_EXTENSION_SCHEMA_ID, 0x04, 0, 0, 0, 9};
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(frame, sizeof(frame)));
+    EXPECT_TRUE(decoded.hasSchemaId());
+    EXPECT_EQ(9u, decoded.getSchemaId());
+}
+
+TEST_F(EZMQHeaderTest, compressionExtension)
+{
+    unsigned char frame[] = {0x08, EZMQ_EXTENSION_COMPRESSION, 0x01, EZMQ_COMPRESSION_LZ4};
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(frame, sizeof(frame)));
+    EXPECT_EQ(EZMQ_COMPRESSION_LZ4, decoded.getCompressionCodec());
+
+    frame[3] = EZMQ_COMPRESSION_ZSTD_DICT;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(frame, sizeof(frame)));
+    EXPECT_EQ(EZMQ_COMPRESSION_ZSTD_DICT, decoded.getCompressionCodec());
+
+    // unknown codec
+    frame[3] = EZMQ_COMPRESSION_ZSTD_DICT + 1;
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(frame, sizeof(frame)));
+    frame[3] = 0xFF;
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(frame, sizeof(frame)));
+}
+
+TEST_F(EZMQHeaderTest, malformed)
+{
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(NULL, 0));
+
+    unsigned char version3[] = {0x0c};
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(version3, sizeof(version3)));
+
+    unsigned char version0[] = {0x00};
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(version0, sizeof(version0)));
+
+    unsigned char truncatedType[] = {0x08, EZMQ_EXTENSION_TIMESTAMP};
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(truncatedType, sizeof(truncatedType)));
+
+    unsigned char truncatedValue[] = {0x08, EZMQ_EXTENSION_TIMESTAMP, 0x08, 0, 0};
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(truncatedValue, sizeof(truncatedValue)));
+
+    unsigned char wrongLength[] = {0x08, EZMQ_EXTENSION_SCHEMA_ID, 0x02, 0, 1};
+    EXPECT_EQ(EZMQ_ERROR, decoded.parse(wrongLength, sizeof(wrongLength)));
+}
+
+TEST_F(EZMQHeaderTest, version1IgnoresTrailingBytes)
+{
+    unsigned char frame[] = {0x24, 0x01, 0x02};
+    EZMQHeader decoded;
+    EXPECT_EQ(EZMQ_OK, decoded.parse(frame, sizeof(frame)));
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_BYTEDATA, decoded.getContentType());
+    EXPECT_FALSE(decoded.hasSequence());
+}
+
+TEST_F(EZMQHeaderTest, eventCopyKeepsSchemaId)
+{
+    ezmq::Event event = getProtoBufEvent();
+    event.setSchemaId(5);
+
+    ezmq::Event copied(event);
+    EXPECT_EQ(5u, copied.getSchemaId());
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_PROTOBUF, copied.getContentType());
+
+    ezmq::Event assigned;
+    assigned = event;
+    EXPECT_EQ(5u, assigned.getSchemaId());
+    EXPECT_EQ(event.SerializeAsString(), assigned.SerializeAsString());
+
+    ezmq::Event moved(std::move(assigned));
+    EXPECT_EQ(5u, moved.getSchemaId());
+}
+
+TEST_F(EZMQHeaderTest, messageDefaultConstructor)
+{
+    EZMQMessage message;
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_PROTOBUF, message.getContentType());
+    EXPECT_EQ(0u, message.getSchemaId());
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include "EZMQJsonData.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQJsonDataTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+};
+
+TEST_F(EZMQJsonDataTest, constructJsonData)
+{
+    EZMQJsonData jsonData("{\"key\":\"value\"}");
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_JSON, jsonData.getContentType());
+    EXPECT_EQ("{\"key\":\"value\"}", jsonData.getJson());
+}
+
+TEST_F(EZMQJsonDataTest, setJson)
+{
+    EZMQJsonData jsonData("");
+    EXPECT_EQ(EZMQ_OK, jsonData.setJson("[1, -2.5e3, true, false, null, {\"a\": [\"\\u00e9\"]}]"));
+    EXPECT_EQ(EZMQ_ERROR, jsonData.setJson("{\"key\":}"));
+    EXPECT_EQ("[1, -2.5e3, true, false, null, {\"a\": [\"\\u00e9\"]}]", jsonData.getJson());
+}
+
+TEST_F(EZMQJsonDataTest, isValid)
+{
+    std::string deep(100, '[');
+    const char *valid[] = { "{}", "[]", "0", "\"\"", " {\"a\" : 1 , \"b\":[]} ", "\"\\ud83d\\ude00\"" };
+    const char *invalid[] = { "", "{", "{\"a\"}", "[1,]", "01", "tru", "\"\\x\"", "\"\\ud83d\"",
+        "{} {}", "\"a\nb\"" };
+    for (const char *json : valid)
+    {
+        EXPECT_TRUE(EZMQJsonData::isValid(json, strlen(json))) << json;
+    }
+    for (const char *json : invalid)
+    {
+        EXPECT_FALSE(EZMQJsonData::isValid(json, strlen(json))) << json;
+    }
+    EXPECT_FALSE(EZMQJsonData::isValid(deep.c_str(), deep.size()));
+    EXPECT_FALSE(EZMQJsonData::isValid(NULL, 0));
+}
+
+TEST_F(EZMQJsonDataTest, eventRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    event.set_device("device \"1\"\n\\");
+    event.set_created(-9223372036854775807LL - 1);
+    event.set_modified(9223372036854775807LL);
+
+    EZMQJsonData jsonData("");
+    EXPECT_EQ(EZMQ_OK, jsonData.setEvent(event));
+    EXPECT_TRUE(EZMQJsonData::isValid(jsonData.getJson().c_str(), jsonData.getJson().size()));
+
+    ezmq::Event decoded;
+    EXPECT_EQ(EZMQ_OK, jsonData.getEvent(decoded));
+    EXPECT_EQ(event.SerializeAsString(), decoded.SerializeAsString());
+}
+
+TEST_F(EZMQJsonDataTest, typedReading)
+{
+    ezmq::Event event = getTypedEvent();
+    ezmq::Reading *reading = event.mutable_reading(0);
+    reading->set_int_value(-9223372036854775807LL - 1);
+    reading->set_binary_value(std::string("\x00\xff\xfe\x01", 4));
+    reading->add_double_values(-1e-300);
+    reading->add_double_values(0.1);
+    reading->add_int_values(9223372036854775807LL);
+
+    EZMQJsonData jsonData("");
+    EXPECT_EQ(EZMQ_OK, jsonData.setEvent(event));
+    const std::string &json = jsonData.getJson();
+    EXPECT_TRUE(EZMQJsonData::isValid(json.c_str(), json.size()));
+    // int64 as string and bytes as base64, as in protobuf JSON mapping
+    EXPECT_NE(std::string::npos, json.find("\"intValue\":\"-9223372036854775808\""));
+    EXPECT_NE(std::string::npos, json.find("\"binaryValue\":\"AP/+AQ==\""));
+    EXPECT_NE(std::string::npos, json.find("\"doubleValue\":10.5"));
+
+    ezmq::Event decoded;
+    EXPECT_EQ(EZMQ_OK, jsonData.getEvent(decoded));
+    EXPECT_EQ(event.SerializeAsString(), decoded.SerializeAsString());
+
+    // Readings without typed values are written as before
+    EXPECT_EQ(EZMQ_OK, jsonData.setEvent(getProtoBufEvent()));
+    EXPECT_EQ(std::string::npos, jsonData.getJson().find("Value"));
+}
+
+TEST_F(EZMQJsonDataTest, typedReadingSpecialValues)
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::Reading *reading = event.mutable_reading(0);
+    reading->add_double_values(std::numeric_limits<double>::infinity());
+    reading->add_double_values(-std::numeric_limits<double>::infinity());
+    reading->add_double_values(std::numeric_limits<double>::quiet_NaN());
+    for (size_t size = 0; size < 4; size++)
+    {
+        reading->set_binary_value(std::string("\x01\x02\x03", size));
+
+        EZMQJsonData jsonData("");
+        EXPECT_EQ(EZMQ_OK, jsonData.setEvent(event));
+        ezmq::Event decoded;
+        EXPECT_EQ(EZMQ_OK, jsonData.getEvent(decoded));
+        const ezmq::Reading &result = decoded.reading(0);
+        EXPECT_EQ(reading->binary_value(), result.binary_value());
+        ASSERT_EQ(3, result.double_values_size());
+        EXPECT_EQ(std::numeric_limits<double>::infinity(), result.double_values(0));
+        EXPECT_EQ(-std::numeric_limits<double>::infinity(), result.double_values(1));
+        EXPECT_TRUE(std::isnan(result.double_values(2)));
+    }
+}
+
+TEST_F(EZMQJsonDataTest, getTypedReading)
+{
+    // Proto field names, numbers for int64, strings for double and URL-safe base64
+    ezmq::Event event;
+    EZMQJsonData jsonData("{\"id\":\"id\",\"created\":1,\"modified\":2,\"origin\":3,"
+        "\"pushed\":4,\"device\":\"d\",\"reading\":[{\"id\":\"r\",\"created\":1,"
+        "\"modified\":2,\"origin\":3,\"pushed\":4,\"name\":\"n\",\"value\":\"\","
+        "\"device\":\"d\",\"double_value\":\"2.5\",\"int_value\":-7,"
+        "\"binary_value\":\"_-8\",\"int_values\":[1,\"-2\"],\"double_values\":[1e2]}]}");
+    EXPECT_EQ(EZMQ_OK, jsonData.getEvent(event));
+    const ezmq::Reading &reading = event.reading(0);
+    EXPECT_EQ(2.5, reading.double_value());
+    EXPECT_EQ(-7, reading.int_value());
+    EXPECT_EQ(std::string("\xff\xef", 2), reading.binary_value());
+    ASSERT_EQ(2, reading.int_values_size());
+    EXPECT_EQ(-2, reading.int_values(1));
+    ASSERT_EQ(1, reading.double_values_size());
+    EXPECT_EQ(100.0, reading.double_values(0));
+
+    // invalid base64 and double
+    EXPECT_EQ(EZMQ_OK, jsonData.setJson("{\"id\":\"id\",\"reading\":[{\"binaryValue\":\"A\"}]}"));
+    EXPECT_EQ(EZMQ_ERROR, jsonData.getEvent(event));
+    EXPECT_EQ(EZMQ_OK, jsonData.setJson("{\"id\":\"id\",\"reading\":[{\"doubleValue\":\"1x\"}]}"));
+    EXPECT_EQ(EZMQ_ERROR, jsonData.getEvent(event));
+}
+
+TEST_F(EZMQJsonDataTest, getEvent)
+{
+    ezmq::Event event;
+    EZMQJsonData jsonData("{\"id\":\"id\",\"created\":\"10\",\"modified\":20,\"origin\":20,"
+        "\"pushed\":10,\"device\":\"d\\u00e9v\",\"unknown\":{\"a\":[1,2]},\"reading\":[]}");
+    EXPECT_EQ(EZMQ_OK, jsonData.getEvent(event));
+    EXPECT_EQ(10, event.created());
+    EXPECT_EQ("d\xc3\xa9v", event.device());
+
+    // required field is missing
+    EXPECT_EQ(EZMQ_OK, jsonData.setJson("{\"id\":\"id\"}"));
+    EXPECT_EQ(EZMQ_ERROR, jsonData.getEvent(event));
+
+    // overflow of int64
+    EXPECT_EQ(EZMQ_OK, jsonData.setJson("{\"id\":\"id\",\"created\":9223372036854775808,"
+        "\"modified\":20,\"origin\":20,\"pushed\":10,\"device\":\"d\"}"));
+    EXPECT_EQ(EZMQ_ERROR, jsonData.getEvent(event));
+
+    // malformed JSON as received by subscriber, which does not validate it
+    EZMQJsonData receivedData("{\"id\":\"id\",\"created\":10,\"reading\":[{\"id\":\"r\"}");
+    EXPECT_EQ(EZMQ_ERROR, receivedData.getEvent(event));
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <limits>
+
+#include "EZMQLatencyHistogram.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQLatencyHistogramTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+
+    EZMQLatencyHistogram mHistogram;
+};
+
+TEST_F(EZMQLatencyHistogramTest, emptyHistogram)
+{
+    EXPECT_EQ(0u, mHistogram.getCount());
+    EXPECT_EQ(0u, mHistogram.getMin());
+    EXPECT_EQ(0u, mHistogram.getMax());
+    EXPECT_EQ(0, mHistogram.getMean());
+    EXPECT_EQ(0u, mHistogram.getPercentile(99));
+}
+
+TEST_F(EZMQLatencyHistogramTest, smallValuesAreExact)
+{
+    for (uint64_t i = 1; i <= 50; i++)
+    {
+        mHistogram.record(i);
+    }
+    EXPECT_EQ(50u, mHistogram.getCount());
+    EXPECT_EQ(1u, mHistogram.getMin());
+    EXPECT_EQ(50u, mHistogram.getMax());
+    EXPECT_DOUBLE_EQ(25.5, mHistogram.getMean());
+    EXPECT_EQ(25u, mHistogram.getPercentile(50));
+    EXPECT_EQ(50u, mHistogram.getPercentile(100));
+    EXPECT_EQ(1u, mHistogram.getPercentile(0));
+
+    // Out of range percentiles are clamped
+    EXPECT_EQ(1u, mHistogram.getPercentile(-50));
+    EXPECT_EQ(1u, mHistogram.getPercentile(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_EQ(50u, mHistogram.getPercentile(1000));
+}
+
+TEST_F(EZMQLatencyHistogramTest, percentiles)
+{
+    for (uint64_t i = 1; i <= 100000; i++)
+    {
+        mHistogram.record(i * 1000);
+    }
+    uint64_t p50 = mHistogram.getPercentile(50);
+    uint64_t p99 = mHistogram.getPercentile(99);
+    uint64_t p999 = mHistogram.getPercentile(99.9);
+    EXPECT_NEAR(50000000.0, (double)p50, 50000000.0 * 0.04);
+    EXPECT_NEAR(99000000.0, (double)p99, 99000000.0 * 0.04);
+    EXPECT_NEAR(99900000.0, (double)p999, 99900000.0 * 0.04);
+    EXPECT_LE(p50, p99);
+    EXPECT_LE(p99, p999);
+    EXPECT_LE(p999, mHistogram.getMax());
+}
+
+TEST_F(EZMQLatencyHistogramTest, largeValue)
+{
+    mHistogram.record(UINT64_MAX);
+    EXPECT_EQ(UINT64_MAX, mHistogram.getMax());
+    EXPECT_EQ(UINT64_MAX, mHistogram.getPercentile(50));
+}
+
+TEST_F(EZMQLatencyHistogramTest, merge)
+{
+    EZMQLatencyHistogram other;
+    mHistogram.record(10);
+    other.record(5);
+    other.record(20);
+    mHistogram.merge(other);
+    EXPECT_EQ(3u, mHistogram.getCount());
+    EXPECT_EQ(5u, mHistogram.getMin());
+    EXPECT_EQ(20u, mHistogram.getMax());
+}
+
+TEST_F(EZMQLatencyHistogramTest, reset)
+{
+    mHistogram.record(100);
+    mHistogram.reset();
+    EXPECT_EQ(0u, mHistogram.getCount());
+    EXPECT_EQ(0u, mHistogram.getPercentile(50));
+    mHistogram.record(7);
+    EXPECT_EQ(7u, mHistogram.getMin());
+}
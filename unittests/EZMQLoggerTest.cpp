@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "EZMQLogger.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+namespace
+{
+    struct LogEntry
+    {
+        int level;
+        std::string tag;
+        std::string logStr;
+    };
+
+    void logSink(int level, const char *tag, uint64_t timestamp, const char *logStr, void *userData)
+    {
+        UNUSED(timestamp);
+        std::vector<LogEntry> *entries = static_cast<std::vector<LogEntry> *>(userData);
+        LogEntry entry;
+        entry.level = level;
+        entry.tag = tag;
+        entry.logStr = logStr;
+        entries->push_back(entry);
+    }
+
+    // Logs once from inside the sink and then restores logSink
+    void reentrantSink(int level, const char *tag, uint64_t timestamp, const char *logStr,
+        void *userData)
+    {
+        logSink(level, tag, timestamp, logStr, userData);
+        EZMQSetLogSink(logSink, userData);
+        EZMQLog(INFO, "EZMQLoggerTest", "from sink");
+    }
+}
+
+class EZMQLoggerTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+        EZMQSetLogSink(logSink, &mEntries);
+    }
+
+    void TearDown()
+    {
+        EZMQSetLogSink(NULL, NULL);
+        EZMQSetLogRateLimit(EZMQ_DEFAULT_LOG_RATE_LIMIT);
+        EZMQSetLogLevel(DEBUG, true);
+        TestWithMock::TearDown();
+    }
+
+    std::vector<LogEntry> mEntries;
+};
+
+TEST_F(EZMQLoggerTest, logToSink)
+{
+    EZMQLog(ERROR, "EZMQLoggerTest", "entry");
+    EZMQLogv(INFO, "EZMQLoggerTest", "entry %d", 2);
+    ASSERT_EQ(2u, mEntries.size());
+    EXPECT_EQ(ERROR, mEntries[0].level);
+    EXPECT_EQ("EZMQLoggerTest", mEntries[0].tag);
+    EXPECT_EQ("entry", mEntries[0].logStr);
+    EXPECT_EQ(INFO, mEntries[1].level);
+    EXPECT_EQ("entry 2", mEntries[1].logStr);
+}
+
+TEST_F(EZMQLoggerTest, logToSinkFiltersLevel)
+{
+    EZMQSetLogLevel(WARNING, true);
+    EZMQLog(INFO, "EZMQLoggerTest", "filtered");
+    EZMQLog(DEBUG_PRIVATE, "EZMQLoggerTest", "filtered");
+    EZMQLog(ERROR_PRIVATE, "EZMQLoggerTest", "private");
+    EXPECT_TRUE(mEntries.empty());
+
+    EZMQSetLogLevel(WARNING, false);
+    EZMQLog(ERROR_PRIVATE, "EZMQLoggerTest", "private");
+    ASSERT_EQ(1u, mEntries.size());
+    EXPECT_EQ(ERROR, mEntries[0].level);
+}
+
+TEST_F(EZMQLoggerTest, logToAsyncSink)
+{
+    EZMQSetAsyncLogging(true);
+    EZMQLogv(WARNING, "EZMQLoggerTest", "queued %s", "entry");
+    EZMQSetAsyncLogging(false);
+    ASSERT_EQ(1u, mEntries.size());
+    EXPECT_EQ(WARNING, mEntries[0].level);
+    EXPECT_EQ("queued entry", mEntries[0].logStr);
+}
+
+TEST_F(EZMQLoggerTest, sinkLogsAndSetsSink)
+{
+    EZMQSetLogSink(reentrantSink, &mEntries);
+    EZMQLog(ERROR, "EZMQLoggerTest", "entry");
+    ASSERT_EQ(2u, mEntries.size());
+    EXPECT_EQ("entry", mEntries[0].logStr);
+    EXPECT_EQ("from sink", mEntries[1].logStr);
+}
+
+TEST_F(EZMQLoggerTest, rateLimit)
+{
+    EZMQSetLogRateLimit(10);
+    EZMQLogRateLimiter limiter;
+    uint32_t suppressed = 0;
+    int allowed = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        if (limiter.allow(suppressed))
+        {
+            allowed++;
+        }
+    }
+    // Calls may span two windows
+    EXPECT_GE(allowed, 10);
+    EXPECT_LE(allowed, 20);
+}
+
+TEST_F(EZMQLoggerTest, rateLimitReportsSuppressed)
+{
+    EZMQSetLogRateLimit(1);
+    EZMQLogRateLimiter limiter;
+    uint32_t suppressed = 0;
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_EQ(0u, suppressed);
+    int dropped = 0;
+    while (!limiter.allow(suppressed))
+    {
+        dropped++;
+    }
+    EXPECT_EQ((uint32_t)dropped, suppressed);
+}
+
+TEST_F(EZMQLoggerTest, rateLimitDisabled)
+{
+    EZMQSetLogRateLimit(0);
+    EZMQLogRateLimiter limiter;
+    uint32_t suppressed = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_TRUE(limiter.allow(suppressed));
+    }
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "EZMQMetrics.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQMetricsTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        mMetrics = new EZMQMetrics("pub:5562");
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        delete mMetrics;
+        TestWithMock::TearDown();
+    }
+
+    EZMQMetrics *mMetrics;
+};
+
+TEST_F(EZMQMetricsTest, add)
+{
+    mMetrics->add("topic1", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->add("topic1", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->add("topic2", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->add("topic2", EZMQ_METRIC_BYTES_SENT, 100);
+    EXPECT_EQ(3u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT));
+    EXPECT_EQ(2u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT, "topic1"));
+    EXPECT_EQ(100u, mMetrics->getValue(EZMQ_METRIC_BYTES_SENT, "topic2"));
+    EXPECT_EQ(0u, mMetrics->getValue(EZMQ_METRIC_BYTES_SENT, "topic3"));
+
+    std::vector<std::string> topics = mMetrics->getTopics();
+    ASSERT_EQ(2u, topics.size());
+    EXPECT_EQ("topic1", topics[0]);
+    EXPECT_EQ("topic2", topics[1]);
+}
+
+TEST_F(EZMQMetricsTest, addValues)
+{
+    mMetrics->add("topic1", {{EZMQ_METRIC_MESSAGES_SENT, 1}, {EZMQ_METRIC_BYTES_SENT, 100}});
+    mMetrics->add("topic2", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->add("topic1", {{EZMQ_METRIC_MESSAGES_SENT, 1}, {EZMQ_METRIC_BYTES_SENT, 50}});
+    EXPECT_EQ(2u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT, "topic1"));
+    EXPECT_EQ(150u, mMetrics->getValue(EZMQ_METRIC_BYTES_SENT, "topic1"));
+    EXPECT_EQ(3u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT));
+}
+
+TEST_F(EZMQMetricsTest, setEnabled)
+{
+    EXPECT_TRUE(mMetrics->isEnabled());
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->setEnabled(false);
+    EXPECT_FALSE(mMetrics->isEnabled());
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    mMetrics->add("topic", {{EZMQ_METRIC_MESSAGES_SENT, 1}});
+    {
+        EZMQMetrics::ScopeTimer timer(*mMetrics, "topic", EZMQ_METRIC_CALLBACK_TIME);
+    }
+    EXPECT_EQ(1u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT, "topic"));
+    EXPECT_EQ(0u, mMetrics->getValue(EZMQ_METRIC_CALLBACK_TIME));
+
+    mMetrics->setEnabled(true);
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    EXPECT_EQ(2u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT, "topic"));
+}
+
+TEST_F(EZMQMetricsTest, addFromThreads)
+{
+    // More threads than shards, some of them share a shard
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 2 * EZMQ_METRIC_SHARDS; i++)
+    {
+        threads.push_back(std::thread([this]()
+        {
+            for (int j = 0; j < 1000; j++)
+            {
+                mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+            }
+        }));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(2u * EZMQ_METRIC_SHARDS * 1000, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT, "topic"));
+    EXPECT_EQ(2u * EZMQ_METRIC_SHARDS * 1000, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT));
+
+    mMetrics->reset();
+    EXPECT_EQ(0u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT));
+}
+
+TEST_F(EZMQMetricsTest, instances)
+{
+    // Slot cached by thread for one instance is not used for another
+    EZMQMetrics other("sub:5562");
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    other.add("topic", EZMQ_METRIC_MESSAGES_RECEIVED, 1);
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    EXPECT_EQ(2u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_SENT));
+    EXPECT_EQ(0u, mMetrics->getValue(EZMQ_METRIC_MESSAGES_RECEIVED));
+    EXPECT_EQ(1u, other.getValue(EZMQ_METRIC_MESSAGES_RECEIVED));
+}
+
+TEST_F(EZMQMetricsTest, reset)
+{
+    mMetrics->add("topic", EZMQ_METRIC_SEND_FAILURES, 1);
+    mMetrics->reset();
+    EXPECT_EQ(0u, mMetrics->getValue(EZMQ_METRIC_SEND_FAILURES));
+    EXPECT_TRUE(mMetrics->getTopics().empty());
+
+    // Counting continues after reset, also for cached topic
+    mMetrics->add("topic", EZMQ_METRIC_SEND_FAILURES, 1);
+    EXPECT_EQ(1u, mMetrics->getValue(EZMQ_METRIC_SEND_FAILURES, "topic"));
+    EXPECT_EQ(1u, mMetrics->getTopics().size());
+}
+
+TEST_F(EZMQMetricsTest, scopeTimer)
+{
+    std::string topic = "topic";
+    {
+        EZMQMetrics::ScopeTimer timer(*mMetrics, topic, EZMQ_METRIC_CALLBACK_TIME);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_LE(1000000u, mMetrics->getValue(EZMQ_METRIC_CALLBACK_TIME, topic));
+
+    // Topic can be a temporary, timer keeps resolved counter
+    {
+        EZMQMetrics::ScopeTimer timer(*mMetrics, topic + "/1", EZMQ_METRIC_CALLBACK_TIME);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_LE(1000000u, mMetrics->getValue(EZMQ_METRIC_CALLBACK_TIME, "topic/1"));
+}
+
+TEST_F(EZMQMetricsTest, toPrometheus)
+{
+    mMetrics->add("home/\"room\"", EZMQ_METRIC_MESSAGES_SENT, 2);
+    mMetrics->add("", EZMQ_METRIC_SERIALIZATION_TIME, 1500000000);
+    std::string text = mMetrics->toPrometheus();
+    EXPECT_NE(std::string::npos, text.find("# TYPE ezmq_messages_sent_total counter\n"));
+    EXPECT_NE(std::string::npos,
+        text.find("ezmq_messages_sent_total{socket=\"pub:5562\",topic=\"home/\\\"room\\\"\"} 2\n"));
+    EXPECT_NE(std::string::npos,
+        text.find("ezmq_serialization_seconds_total{socket=\"pub:5562\",topic=\"\"} 1.5\n"));
+    EXPECT_EQ(std::string::npos, text.find("ezmq_messages_received_total"));
+}
+
+TEST_F(EZMQMetricsTest, writePrometheus)
+{
+    std::string path = "ezmq_metrics_test.prom";
+    mMetrics->add("topic", EZMQ_METRIC_MESSAGES_SENT, 1);
+    EXPECT_EQ(EZMQ_OK, mMetrics->writePrometheus(path));
+    EXPECT_EQ(EZMQ_OK, mMetrics->writePrometheus(path));
+    std::ifstream file(path.c_str());
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(mMetrics->toPrometheus(), content.str());
+    remove(path.c_str());
+
+    EXPECT_EQ(EZMQ_ERROR, mMetrics->writePrometheus("/nonexistent/dir/metrics.prom"));
+}
@@ -15,9 +15,19 @@
  *
  *******************************************************************************/
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 #include "EZMQAPI.h"
 #include "EZMQLogger.h"
 #include "EZMQPublisher.h"
+#include "EZMQSubscriber.h"
+#include "EZMQHeader.h"
+#include "EZMQJsonData.h"
+#include "EZMQEventBatch.h"
+#include "EZMQSegmentedByteData.h"
 #include "UnitTestHelper.h"
 
 // put server secret key
@@ -83,6 +93,53 @@ class EZMQPublisherTest: public TestWithMock
             TestWithMock::TearDown();
         }
 
+        // Raw SUB socket, to check EZMQ header as sent by publisher
+        void connectSocket(zmq::socket_t &socket)
+        {
+            int linger = 0;
+            int timeout = 100;
+            socket.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+            socket.setsockopt(ZMQ_RCVTIMEO, &timeout, sizeof(timeout));
+            socket.setsockopt(ZMQ_SUBSCRIBE, "topic/", 6);
+            socket.connect("tcp://localhost:" + std::to_string(mPort));
+        }
+
+        bool receiveHeader(zmq::socket_t &socket, EZMQHeader &header)
+        {
+            zmq::message_t topicFrame;
+            zmq::message_t headerFrame;
+            zmq::message_t dataFrame;
+            if(!socket.recv(&topicFrame) || !socket.recv(&headerFrame) || !socket.recv(&dataFrame))
+            {
+                return false;
+            }
+            return EZMQ_OK == header.parse(headerFrame.data(), headerFrame.size());
+        }
+
+        // Publish until subscriber has joined and received a message
+        bool joinSocket(zmq::socket_t &socket, const EZMQMessage &event, EZMQHeader &header)
+        {
+            for (int i = 0; i < 50; i++)
+            {
+                EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+                if(receiveHeader(socket, header))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Predicate>
+        bool waitFor(Predicate predicate)
+        {
+            for (int i = 0; i < 200 && !predicate(); i++)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return predicate();
+        }
+
         EZMQAPI *apiInstance;
         EZMQPublisher *mPublisher;
         std::string  mTopic;
@@ -251,6 +308,422 @@ TEST_F(EZMQPublisherTest, publishNegative)
     EXPECT_EQ(EZMQ_OK, mPublisher->publish(topicList, byteEvent));
 }
 
+TEST_F(EZMQPublisherTest, lastValueCache)
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::EZMQByteData byteEvent = getByteData();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setLastValueCache(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setLastValueCache(false));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, byteEvent));
+}
+
+TEST_F(EZMQPublisherTest, lastValueCacheStartStop)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setLastValueCache(true));
+    for( int i =1; i<=10; i++)
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->start());
+        EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+        EXPECT_EQ(EZMQ_OK, mPublisher->stop());
+    }
+}
+
+TEST_F(EZMQPublisherTest, skipUnwatchedTopics)
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::EZMQByteData byteEvent = getByteData();
+    EXPECT_TRUE(mPublisher->hasSubscribers(mTopic));
+    EXPECT_EQ(EZMQ_OK, mPublisher->setSkipUnwatchedTopics(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setSkipUnwatchedTopics(false));
+    EXPECT_FALSE(mPublisher->hasSubscribers(mTopic));
+    EXPECT_FALSE(mPublisher->hasSubscribers(""));
+    EXPECT_FALSE(mPublisher->hasSubscribers("topic/$"));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, byteEvent));
+}
+
+TEST_F(EZMQPublisherTest, sequenceNumbers)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setSequenceNumbers(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->setLastValueCache(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setSequenceNumbers(false));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+}
+
+TEST_F(EZMQPublisherTest, publishTimestamps)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setPublishTimestamps(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setPublishTimestamps(false));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+}
+
+TEST_F(EZMQPublisherTest, publishSchemaId)
+{
+    ezmq::Event event = getProtoBufEvent();
+    event.setSchemaId(3);
+    EXPECT_EQ(3u, event.getSchemaId());
+    EXPECT_EQ(EZMQ_OK, mPublisher->setSequenceNumbers(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->setPublishTimestamps(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+}
+
+TEST_F(EZMQPublisherTest, lastValueCacheRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    event.set_id("last");
+    EXPECT_EQ(EZMQ_OK, mPublisher->setLastValueCache(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    // Published before subscriber joins, only the cache can deliver it
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+
+    std::mutex lock;
+    std::atomic<int> received(0);
+    std::string receivedTopic;
+    std::string receivedId;
+    EZMQSubscriber subscriber("localhost", mPort, [](const EZMQMessage &) {},
+        [&](const std::string &topic, const EZMQMessage &message)
+        {
+            const Event *receivedEvent = dynamic_cast<const Event *>(&message);
+            std::lock_guard<std::mutex> guard(lock);
+            receivedTopic = topic;
+            receivedId = receivedEvent ? receivedEvent->id() : "";
+            received++;
+        });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+    ASSERT_TRUE(waitFor([&]() { return received > 0; }));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+
+    std::lock_guard<std::mutex> guard(lock);
+    EXPECT_EQ(1, received);
+    EXPECT_EQ(mTopic, receivedTopic);
+    EXPECT_EQ("last", receivedId);
+}
+
+TEST_F(EZMQPublisherTest, sequenceNumbersRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setSequenceNumbers(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    zmq::socket_t socket(*(apiInstance->getContext()), ZMQ_SUB);
+    connectSocket(socket);
+
+    EZMQHeader first;
+    ASSERT_TRUE(joinSocket(socket, event, first));
+    ASSERT_TRUE(first.hasSequence());
+    EXPECT_LT(0u, first.getSequence());
+
+    // Sequence of a topic increases by one per message
+    EZMQHeader next;
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    ASSERT_TRUE(receiveHeader(socket, next));
+    ASSERT_TRUE(next.hasSequence());
+    EXPECT_EQ(first.getPublisherId(), next.getPublisherId());
+    EXPECT_EQ(first.getSequence() + 1, next.getSequence());
+}
+
+TEST_F(EZMQPublisherTest, publishTimestampsRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setPublishTimestamps(true));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    zmq::socket_t socket(*(apiInstance->getContext()), ZMQ_SUB);
+    connectSocket(socket);
+
+    EZMQHeader header;
+    ASSERT_TRUE(joinSocket(socket, event, header));
+    auto now = []()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    };
+    uint64_t before = now();
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    ASSERT_TRUE(receiveHeader(socket, header));
+    uint64_t after = now();
+    ASSERT_TRUE(header.hasTimestamp());
+    EXPECT_LE(before, header.getTimestamp());
+    EXPECT_GE(after, header.getTimestamp());
+}
+
+TEST_F(EZMQPublisherTest, publishSchemaIdRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::EZMQByteData byteEvent = getByteData();
+    event.setSchemaId(3);
+    byteEvent.setSchemaId(4);
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+
+    std::mutex lock;
+    std::vector<uint32_t> schemaIds;
+    EZMQSubscriber subscriber("localhost", mPort, [](const EZMQMessage &) {},
+        [&](const std::string &, const EZMQMessage &message)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            schemaIds.push_back(message.getSchemaId());
+        });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+
+    auto isReceived = [&]()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return !schemaIds.empty();
+    };
+    for (int i = 0; i < 50 && !isReceived(); i++)
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_TRUE(isReceived());
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, byteEvent));
+    ASSERT_TRUE(waitFor([&]()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return 4u == schemaIds.back();
+    }));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+    EXPECT_EQ(3u, schemaIds.front());
+}
+
+TEST_F(EZMQPublisherTest, duplicateSubscriptionRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+
+    std::atomic<int> topicCount(0);
+    std::atomic<int> otherCount(0);
+    EZMQSubscriber subscriber("localhost", mPort, [](const EZMQMessage &) {},
+        [&](const std::string &topic, const EZMQMessage &)
+        {
+            if(0 == topic.compare(0, mTopic.size(), mTopic))
+            {
+                topicCount++;
+            }
+        });
+    auto handler = [&](const std::string &, const EZMQMessage &) { otherCount++; };
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe("other", handler));
+    for (int i = 0; i < 50 && 0 == otherCount; i++)
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->publish("other", event));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, otherCount);
+
+    // Single unsubscribe removes the duplicated subscription
+    EXPECT_EQ(EZMQ_OK, subscriber.unSubscribe(mTopic));
+    int expected = otherCount + 1;
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish("other", event));
+    ASSERT_TRUE(waitFor([&]() { return otherCount >= expected; }));
+    EXPECT_EQ(0, topicCount);
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQPublisherTest, subscribeFromHandlerRoundTrip)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+
+    std::atomic<int> topicCount(0);
+    std::atomic<int> nestedCount(0);
+    EZMQSubscriber subscriber("localhost", mPort, [](const EZMQMessage &) {},
+        [](const std::string &, const EZMQMessage &) {});
+    auto nestedHandler = [&](const std::string &, const EZMQMessage &) { nestedCount++; };
+    // Handler changes handlers of its own topic while being dispatched
+    auto handler = [&](const std::string &, const EZMQMessage &)
+    {
+        if(1 == ++topicCount)
+        {
+            EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic + "/nested", nestedHandler));
+            EXPECT_EQ(EZMQ_OK, subscriber.unSubscribe(mTopic + "/other"));
+        }
+    };
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic, handler));
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic + "/other", handler));
+    for (int i = 0; i < 50 && 0 == topicCount; i++)
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, topicCount);
+
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic + "/nested", event));
+    ASSERT_TRUE(waitFor([&]() { return nestedCount > 0; }));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQPublisherTest, getMetrics)
+{
+    ezmq::Event event = getProtoBufEvent();
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EZMQMetrics &metrics = mPublisher->getMetrics();
+    EXPECT_EQ(2u, metrics.getValue(EZMQ_METRIC_MESSAGES_SENT));
+    EXPECT_EQ(1u, metrics.getValue(EZMQ_METRIC_MESSAGES_SENT, mTopic));
+    EXPECT_EQ(0u, metrics.getValue(EZMQ_METRIC_MESSAGES_SENT, mTopic + "/"));
+    EXPECT_LT(0u, metrics.getValue(EZMQ_METRIC_BYTES_SENT, mTopic));
+    EXPECT_EQ(0u, metrics.getValue(EZMQ_METRIC_SEND_FAILURES));
+}
+
+TEST_F(EZMQPublisherTest, setSocketMonitor)
+{
+    std::atomic<int> listening(0);
+    EXPECT_EQ(EZMQ_OK, mPublisher->setSocketMonitor(true,
+        [&listening](EZMQSocketEvent event, const std::string &/*address*/)
+        {
+            if(EZMQ_SOCKET_EVENT_LISTENING == event)
+            {
+                listening++;
+            }
+        }));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setSocketMonitor(false));
+    for (int i = 0; i < 100 && 0 == listening; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(1, listening);
+    EXPECT_EQ(1u, mPublisher->getSocketEventCount(EZMQ_SOCKET_EVENT_LISTENING));
+    EXPECT_EQ(EZMQ_OK, mPublisher->stop());
+}
+
+TEST_F(EZMQPublisherTest, publishJsonData)
+{
+    ezmq::EZMQJsonData jsonData("");
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->publish(jsonData));
+    EXPECT_EQ(EZMQ_OK, jsonData.setEvent(getProtoBufEvent()));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(jsonData));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, jsonData));
+}
+
+TEST_F(EZMQPublisherTest, publishEventBatch)
+{
+    ezmq::EZMQEventBatch eventBatch;
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->publish(eventBatch));
+    EXPECT_EQ(EZMQ_OK, eventBatch.setEvent(getProtoBufEvent()));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(eventBatch));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, eventBatch));
+}
+
+TEST_F(EZMQPublisherTest, publishSegmentedByteData)
+{
+    uint8_t header[] = { 0x40, 0x05 };
+    EZMQSegmentedByteData segmentedData;
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->publish(segmentedData));
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(header, sizeof(header)));
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(EZMQOwnedByteData(std::string(4096, 'y'))));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(segmentedData));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, segmentedData));
+}
+
+TEST_F(EZMQPublisherTest, segmentedByteDataRoundTrip)
+{
+    uint8_t header[] = { 0xA0, 0x05 };
+    EZMQSegmentedByteData segmentedData;
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(header, sizeof(header)));
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(EZMQOwnedByteData(std::string(4096, 'y'))));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+
+    // Segmented data without topic is delivered to callback without topic
+    std::atomic<int> received(0);
+    std::atomic<int> receivedWithTopic(0);
+    std::atomic<size_t> segmentCount(0);
+    EZMQSubscriber subscriber("localhost", mPort,
+        [&](const EZMQMessage &message)
+        {
+            const EZMQSegmentedByteData *data = dynamic_cast<const EZMQSegmentedByteData *>(&message);
+            segmentCount = data ? data->getSegmentCount() : 0;
+            received++;
+        },
+        [&](const std::string &, const EZMQMessage &) { receivedWithTopic++; });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe());
+    for (int i = 0; i < 50 && 0 == received; i++)
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->publish(segmentedData));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, received);
+    EXPECT_EQ(2u, segmentCount);
+
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, segmentedData));
+    ASSERT_TRUE(waitFor([&]() { return receivedWithTopic > 0; }));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQPublisherTest, publishTypedReading)
+{
+    ezmq::Event event = getTypedEvent();
+    std::string data = event.SerializeAsString();
+    ezmq::Event decoded;
+    EXPECT_TRUE(decoded.ParseFromString(data));
+    EXPECT_EQ(data, decoded.SerializeAsString());
+    EXPECT_EQ(-10, decoded.reading(0).int_value());
+    EXPECT_EQ(8, decoded.reading(0).double_values_size());
+    EXPECT_FALSE(decoded.reading(1).has_double_value());
+
+    // Typed values are appended after the string fields
+    ezmq::Reading reading = event.reading(0);
+    std::string typed = reading.SerializeAsString();
+    reading.clear_double_value();
+    reading.clear_int_value();
+    reading.clear_binary_value();
+    reading.clear_double_values();
+    reading.clear_int_values();
+    std::string legacy = reading.SerializeAsString();
+    EXPECT_EQ(0, typed.compare(0, legacy.size(), legacy));
+
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+}
+
+TEST_F(EZMQPublisherTest, compression)
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::EZMQByteData byteEvent = getByteData();
+    EXPECT_EQ(EZMQ_OK, mPublisher->setCompression(EZMQ_COMPRESSION_NONE, 0, 0));
+    if(EZMQCompression::isSupported(EZMQ_COMPRESSION_ZSTD))
+    {
+        EXPECT_EQ(EZMQ_OK, mPublisher->setCompression(EZMQ_COMPRESSION_ZSTD, 3, 0));
+    }
+    else
+    {
+        EXPECT_EQ(EZMQ_ERROR, mPublisher->setCompression(EZMQ_COMPRESSION_ZSTD, 3, 0));
+    }
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setCompressionDictionary(nullptr));
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setCompressionDictionary(
+        std::make_shared<EZMQCompressionDictionary>("not a dictionary", 0)));
+    EXPECT_EQ(EZMQ_OK, mPublisher->start());
+    EXPECT_EQ(EZMQ_ERROR, mPublisher->setCompression(EZMQ_COMPRESSION_NONE, 0, 0));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, event));
+    EXPECT_EQ(EZMQ_OK, mPublisher->publish(mTopic, byteEvent));
+}
+
 TEST_F(EZMQPublisherTest, getPort)
 {
     EXPECT_EQ(mPort, mPublisher->getPort());
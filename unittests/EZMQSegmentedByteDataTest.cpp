@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQSegmentedByteData.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQSegmentedByteDataTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+};
+
+TEST_F(EZMQSegmentedByteDataTest, constructSegmentedByteData)
+{
+    EZMQSegmentedByteData segmentedData;
+    EXPECT_EQ(EZMQ_CONTENT_TYPE_SEGMENTED_BYTEDATA, segmentedData.getContentType());
+    EXPECT_EQ(0u, segmentedData.getSegmentCount());
+    EXPECT_EQ(0u, segmentedData.getLength());
+}
+
+TEST_F(EZMQSegmentedByteDataTest, addSegment)
+{
+    uint8_t header[] = { 0x40, 0x05 };
+    std::string plane(1024, 'y');
+    const uint8_t *planeData = reinterpret_cast<const uint8_t *>(plane.data());
+
+    EZMQSegmentedByteData segmentedData;
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(header, sizeof(header)));
+    EXPECT_EQ(EZMQ_OK, segmentedData.addSegment(EZMQOwnedByteData(std::move(plane))));
+    EXPECT_EQ(2u, segmentedData.getSegmentCount());
+    EXPECT_EQ(sizeof(header) + 1024, segmentedData.getLength());
+
+    // segments are not copied
+    EXPECT_EQ(header, segmentedData.getSegment(0).getByteData());
+    EXPECT_EQ(planeData, segmentedData.getSegment(1).getByteData());
+
+    EZMQOwnedByteData retained = segmentedData.getSegment(1).share();
+    segmentedData.clear();
+    EXPECT_EQ(0u, segmentedData.getSegmentCount());
+    EXPECT_EQ(planeData, retained.getByteData());
+    EXPECT_EQ('y', retained.getByteData()[1023]);
+}
+
+TEST_F(EZMQSegmentedByteDataTest, addSegmentNegative)
+{
+    uint8_t header[] = { 0x40, 0x05 };
+    EZMQSegmentedByteData segmentedData;
+    EXPECT_EQ(EZMQ_ERROR, segmentedData.addSegment(NULL, sizeof(header)));
+    EXPECT_EQ(EZMQ_ERROR, segmentedData.addSegment(header, 0));
+    EXPECT_EQ(EZMQ_ERROR, segmentedData.addSegment(EZMQOwnedByteData()));
+    EXPECT_EQ(0u, segmentedData.getSegmentCount());
+}
@@ -18,6 +18,7 @@
 #include "EZMQAPI.h"
 #include "EZMQLogger.h"
 #include "EZMQSubscriber.h"
+#include "EZMQHeader.h"
 #include "UnitTestHelper.h"
 
 #define TAG "EZMQ_PUB_TEST"
@@ -225,6 +226,242 @@ TEST_F(EZMQSubscriberTest, subscribeTopics)
     EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe(testingTopic));
 }
 
+TEST_F(EZMQSubscriberTest, subscribeTopicHandler)
+{
+    EXPECT_EQ(EZMQ_OK, mSubscriber->start());
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe(mTopic, subTopicCB));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe("topic/livingroom", subTopicCB));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe(mTopic, subTopicCB));
+    EXPECT_EQ(EZMQ_INVALID_TOPIC, mSubscriber->subscribe("", subTopicCB));
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->subscribe(mTopic, nullptr));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->unSubscribe(mTopic));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->unSubscribe("topic/livingroom"));
+}
+
+TEST_F(EZMQSubscriberTest, subscribeWildcard)
+{
+    EXPECT_EQ(EZMQ_OK, mSubscriber->start());
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe("topic/+/light"));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe("topic/#"));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe("+/light", subTopicCB));
+    EXPECT_EQ(EZMQ_INVALID_TOPIC, mSubscriber->subscribe("topic/light+"));
+    EXPECT_EQ(EZMQ_INVALID_TOPIC, mSubscriber->subscribe("topic/#/light"));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->unSubscribe("topic/+/light"));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->unSubscribe("topic/#"));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->unSubscribe("+/light"));
+}
+
+TEST_F(EZMQSubscriberTest, addCompressionDictionary)
+{
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->addCompressionDictionary(nullptr));
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->addCompressionDictionary(
+        std::make_shared<EZMQCompressionDictionary>("not a dictionary", 0)));
+}
+
+TEST_F(EZMQSubscriberTest, getDroppedCount)
+{
+    EXPECT_EQ(0u, mSubscriber->getDroppedCount());
+    EXPECT_EQ(EZMQ_OK, mSubscriber->start());
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe(mTopic));
+    EXPECT_EQ(0u, mSubscriber->getDroppedCount(mTopic));
+    EXPECT_EQ(0u, mSubscriber->getDroppedCount(""));
+}
+
+TEST_F(EZMQSubscriberTest, getLatencyHistogram)
+{
+    EZMQLatencyHistogram histogram;
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->getLatencyHistogram(mTopic, histogram));
+    EXPECT_EQ(0u, histogram.getCount());
+    mSubscriber->resetLatencyHistograms();
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->getLatencyHistogram("", histogram));
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->getLatencyHistogram(histogram));
+}
+
+TEST_F(EZMQSubscriberTest, getRejectedCount)
+{
+    zmq::socket_t publisher(*(apiInstance->getContext()), ZMQ_PUB);
+    int linger = 0;
+    publisher.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    publisher.bind("tcp://*:5562");
+    EXPECT_EQ(EZMQ_OK, mSubscriber->start());
+    EXPECT_EQ(EZMQ_OK, mSubscriber->subscribe(mTopic));
+    EXPECT_EQ(0u, mSubscriber->getRejectedCount());
+
+    // Empty header frame, resent until subscription reaches publisher
+    for (int i = 0; i < 100 && 0 == mSubscriber->getRejectedCount(); i++)
+    {
+        publisher.send("topic/", 6, ZMQ_SNDMORE);
+        publisher.send("", 0, ZMQ_SNDMORE);
+        publisher.send("data", 4);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    EXPECT_LT(0u, mSubscriber->getRejectedCount());
+}
+
+TEST_F(EZMQSubscriberTest, getDroppedCountSequenceGap)
+{
+    zmq::socket_t publisher(*(apiInstance->getContext()), ZMQ_PUB);
+    int linger = 0;
+    publisher.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    publisher.bind("tcp://*:5562");
+
+    std::atomic<int> received(0);
+    EZMQSubscriber subscriber(mIp, mPort, [](const EZMQMessage &) {},
+        [&](const std::string &, const EZMQMessage &) { received++; });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_BYTEDATA);
+    std::vector<unsigned char> headerData;
+    auto send = [&](uint64_t sequence)
+    {
+        header.setSequence(7, sequence);
+        headerData.resize(header.getSize());
+        header.write(headerData.data());
+        publisher.send("topic/", 6, ZMQ_SNDMORE);
+        publisher.send(headerData.data(), headerData.size(), ZMQ_SNDMORE);
+        publisher.send("data", 4);
+    };
+
+    // Repeated first sequence is not a gap, resent until subscription reaches publisher
+    for (int i = 0; i < 100 && 0 == received; i++)
+    {
+        send(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, received);
+    EXPECT_EQ(0u, subscriber.getDroppedCount());
+
+    // Sequence 2 is skipped
+    int expected = received + 1;
+    send(3);
+    for (int i = 0; i < 100 && received < expected; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_LT(0u, subscriber.getDroppedCount());
+    EXPECT_EQ(1u, subscriber.getDroppedCount(mTopic));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQSubscriberTest, getDroppedCountTopicLimit)
+{
+    zmq::socket_t publisher(*(apiInstance->getContext()), ZMQ_PUB);
+    int linger = 0;
+    publisher.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    publisher.bind("tcp://*:5562");
+
+    std::atomic<int> received(0);
+    EZMQSubscriber subscriber(mIp, mPort, [](const EZMQMessage &) {},
+        [&](const std::string &, const EZMQMessage &) { received++; });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe(mTopic));
+
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_BYTEDATA);
+    std::vector<unsigned char> headerData;
+    auto send = [&](const std::string &topic, uint64_t sequence)
+    {
+        header.setSequence(7, sequence);
+        headerData.resize(header.getSize());
+        header.write(headerData.data());
+        publisher.send(topic.c_str(), topic.size(), ZMQ_SNDMORE);
+        publisher.send(headerData.data(), headerData.size(), ZMQ_SNDMORE);
+        publisher.send("data", 4);
+    };
+
+    for (int i = 0; i < 100 && 0 == received; i++)
+    {
+        send("topic/", 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, received);
+
+    // One drop on each of 100 topics, only 64 of them are counted per topic
+    int expected = received + 200;
+    for (int i = 0; i < 100; i++)
+    {
+        std::string topic = "topic/" + std::to_string(i) + "/";
+        send(topic, 1);
+        send(topic, 3);
+    }
+    for (int i = 0; i < 100 && received < expected; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(100u, subscriber.getDroppedCount());
+    EXPECT_EQ(1u, subscriber.getDroppedCount("topic/0"));
+    EXPECT_EQ(0u, subscriber.getDroppedCount("topic/99"));
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQSubscriberTest, topicFirstByte)
+{
+    zmq::socket_t publisher(*(apiInstance->getContext()), ZMQ_PUB);
+    int linger = 0;
+    publisher.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    publisher.bind("tcp://*:5562");
+
+    // Topic frame is never taken for header, whatever its first byte is
+    std::atomic<int> received(0);
+    std::string receivedTopic;
+    EZMQSubscriber subscriber(mIp, mPort, [](const EZMQMessage &) {},
+        [&](const std::string &topic, const EZMQMessage &)
+        {
+            if(0 == received)
+            {
+                receivedTopic = topic;
+            }
+            received++;
+        });
+    EXPECT_EQ(EZMQ_OK, subscriber.start());
+    EXPECT_EQ(EZMQ_OK, subscriber.subscribe());
+
+    EZMQHeader header;
+    header.setContentType(EZMQ_CONTENT_TYPE_BYTEDATA);
+    unsigned char headerData[1];
+    ASSERT_EQ(sizeof(headerData), header.getSize());
+    header.write(headerData);
+    for (int i = 0; i < 100 && 0 == received; i++)
+    {
+        publisher.send("\xA0topic/", 7, ZMQ_SNDMORE);
+        publisher.send(headerData, sizeof(headerData), ZMQ_SNDMORE);
+        publisher.send("data", 4);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_LT(0, received);
+    EXPECT_EQ("\xA0topic", receivedTopic);
+    EXPECT_EQ(0u, subscriber.getRejectedCount());
+    EXPECT_EQ(EZMQ_OK, subscriber.stop());
+}
+
+TEST_F(EZMQSubscriberTest, getMetrics)
+{
+    EZMQMetrics &metrics = mSubscriber->getMetrics();
+    EXPECT_EQ(0u, metrics.getValue(EZMQ_METRIC_MESSAGES_RECEIVED));
+    EXPECT_EQ(std::string::npos, metrics.toPrometheus().find("ezmq_messages_received_total"));
+}
+
+TEST_F(EZMQSubscriberTest, setSocketMonitor)
+{
+    EXPECT_EQ(EZMQ_OK, mSubscriber->setSocketMonitor(true));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->start());
+    EXPECT_EQ(EZMQ_ERROR, mSubscriber->setSocketMonitor(false));
+
+    // No publisher is listening, so connect is delayed or retried
+    uint64_t attempts = 0;
+    for (int i = 0; i < 100 && 0 == attempts; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        attempts = mSubscriber->getSocketEventCount(EZMQ_SOCKET_EVENT_CONNECT_DELAYED) +
+            mSubscriber->getSocketEventCount(EZMQ_SOCKET_EVENT_CONNECT_RETRIED);
+    }
+    EXPECT_LT(0u, attempts);
+    EXPECT_EQ(0u, mSubscriber->getSocketEventCount(EZMQ_SOCKET_EVENT_CONNECTED));
+    EXPECT_EQ(EZMQ_OK, mSubscriber->stop());
+}
+
 TEST_F(EZMQSubscriberTest, unSubscribe)
 {
     EXPECT_EQ(EZMQ_OK, mSubscriber->start());
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include "EZMQTopicTrie.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+class EZMQTopicTrieTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        mCount = 0;
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        TestWithMock::TearDown();
+    }
+
+    EZMQTopicTrie::Handler getHandler()
+    {
+        return [this](const std::string &/*topic*/, const EZMQMessage &/*event*/) { mCount++; };
+    }
+
+    EZMQTopicTrie mTrie;
+    int mCount;
+};
+
+TEST_F(EZMQTopicTrieTest, emptyTrie)
+{
+    std::vector<EZMQTopicTrie::Handler> handlers;
+    EXPECT_TRUE(mTrie.empty());
+    EXPECT_EQ(0u, mTrie.match("topic", handlers));
+    EXPECT_FALSE(mTrie.erase("topic/"));
+}
+
+TEST_F(EZMQTopicTrieTest, matchPrefix)
+{
+    std::vector<EZMQTopicTrie::Handler> handlers;
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("home/livingroom/", getHandler());
+    mTrie.insert("office/", getHandler());
+    EXPECT_FALSE(mTrie.empty());
+
+    EXPECT_EQ(1u, mTrie.match("home", handlers));
+    EXPECT_EQ(2u, mTrie.match("home/livingroom", handlers));
+    EXPECT_EQ(2u, mTrie.match("home/livingroom/light/", handlers));
+    EXPECT_EQ(0u, mTrie.match("homes", handlers));
+    EXPECT_EQ(1u, mTrie.match("home/livingroom2", handlers));
+    EXPECT_EQ(0u, mTrie.match("", handlers));
+
+    ezmq::EZMQByteData byteData = getByteData();
+    for (auto &handler : handlers)
+    {
+        handler("topic", byteData);
+    }
+    EXPECT_EQ(6, mCount);
+}
+
+TEST_F(EZMQTopicTrieTest, replaceAndErase)
+{
+    std::vector<EZMQTopicTrie::Handler> handlers;
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("home/livingroom/", getHandler());
+    EXPECT_EQ(2u, mTrie.match("home/livingroom", handlers));
+
+    EXPECT_TRUE(mTrie.erase("home/"));
+    EXPECT_FALSE(mTrie.erase("home/"));
+    EXPECT_FALSE(mTrie.erase("home/living"));
+    EXPECT_EQ(1u, mTrie.match("home/livingroom", handlers));
+    EXPECT_EQ(0u, mTrie.match("home", handlers));
+
+    EXPECT_TRUE(mTrie.erase("home/livingroom/"));
+    EXPECT_TRUE(mTrie.empty());
+    EXPECT_EQ(0u, mTrie.match("home/livingroom", handlers));
+}
+
+TEST_F(EZMQTopicTrieTest, clear)
+{
+    std::vector<EZMQTopicTrie::Handler> handlers;
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("office/", getHandler());
+    mTrie.clear();
+    EXPECT_TRUE(mTrie.empty());
+    EXPECT_EQ(0u, mTrie.match("home", handlers));
+}
+
+TEST_F(EZMQTopicTrieTest, matchVisitor)
+{
+    int count = 0;
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("home/+/light/", getHandler());
+    EXPECT_EQ(2u, mTrie.match("home/kitchen/light", [](const EZMQTopicTrie::Handler &handler,
+        void *context)
+    {
+        EXPECT_TRUE(static_cast<bool>(handler));
+        (*static_cast<int *>(context))++;
+    }, &count));
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(0u, mTrie.match("office", NULL, NULL));
+}
+
+TEST_F(EZMQTopicTrieTest, contains)
+{
+    mTrie.insert("home/kitchen/", getHandler());
+    EXPECT_TRUE(mTrie.contains("home/kitchen/"));
+    EXPECT_FALSE(mTrie.contains("home/"));
+    EXPECT_FALSE(mTrie.contains("home/kitchen/light/"));
+    EXPECT_FALSE(mTrie.contains(""));
+}
+
+TEST_F(EZMQTopicTrieTest, hasPrefixOf)
+{
+    EXPECT_FALSE(mTrie.hasPrefixOf("home/kitchen"));
+    mTrie.insert("home/kit", nullptr);
+    mTrie.insert("office/+", nullptr);
+    EXPECT_TRUE(mTrie.hasPrefixOf("home/kitchen"));
+    EXPECT_TRUE(mTrie.hasPrefixOf("home/kit"));
+    EXPECT_FALSE(mTrie.hasPrefixOf("home/ki"));
+    EXPECT_FALSE(mTrie.hasPrefixOf("office/room"));
+    EXPECT_TRUE(mTrie.hasPrefixOf("office/+/light"));
+
+    mTrie.insert("", nullptr);
+    EXPECT_TRUE(mTrie.hasPrefixOf("office/room"));
+    EXPECT_TRUE(mTrie.hasPrefixOf(""));
+}
+
+TEST_F(EZMQTopicTrieTest, matchSingleLevelWildcard)
+{
+    std::vector<EZMQTopicTrie::Handler> handlers;
+    mTrie.insert("home/+/light/", getHandler());
+    EXPECT_TRUE(mTrie.hasWildcards());
+
+    EXPECT_EQ(1u, mTrie.match("home/kitchen/light", handlers));
+    EXPECT_EQ(1u, mTrie.match("home/livingroom/light/", handlers));
+    EXPECT_EQ(0u, mTrie.match("home/kitchen/light/1", handlers));
+    EXPECT_EQ(0u, mTrie.match("home/kitchen/lights", handlers));
+    EXPECT_EQ(0u, mTrie.match("home/light", handlers));
+    EXPECT_EQ(0u, mTrie.match("office/kitchen/light", handlers));
+    EXPECT_EQ(2u, handlers.size());
+
+    mTrie.insert("home/+/light/+/", getHandler());
+    EXPECT_EQ(1u, mTrie.count("home/kitchen/light/1"));
+    EXPECT_EQ(1u, mTrie.count("home/kitchen/light"));
+
+    EXPECT_TRUE(mTrie.erase("home/+/light/"));
+    EXPECT_TRUE(mTrie.erase("home/+/light/+/"));
+    EXPECT_FALSE(mTrie.hasWildcards());
+    EXPECT_TRUE(mTrie.empty());
+}
+
+TEST_F(EZMQTopicTrieTest, matchMultiLevelWildcard)
+{
+    mTrie.insert("home/#/", getHandler());
+    EXPECT_EQ(1u, mTrie.count("home"));
+    EXPECT_EQ(1u, mTrie.count("home/kitchen"));
+    EXPECT_EQ(1u, mTrie.count("home/kitchen/light/1"));
+    EXPECT_EQ(0u, mTrie.count("homes/kitchen"));
+
+    mTrie.insert("#/", getHandler());
+    mTrie.insert("home/", getHandler());
+    mTrie.insert("+/+/light/", getHandler());
+    EXPECT_EQ(4u, mTrie.count("home/kitchen/light"));
+    EXPECT_EQ(1u, mTrie.count("office"));
+    EXPECT_EQ(1u, mTrie.count(""));
+}
+
+TEST_F(EZMQTopicTrieTest, validateWildcard)
+{
+    EXPECT_FALSE(EZMQTopicTrie::isWildcard("home/kitchen/"));
+    EXPECT_TRUE(EZMQTopicTrie::isWildcard("home/+/"));
+    EXPECT_TRUE(EZMQTopicTrie::isValidWildcard("home/kitchen/"));
+    EXPECT_TRUE(EZMQTopicTrie::isValidWildcard("+/+/light/"));
+    EXPECT_TRUE(EZMQTopicTrie::isValidWildcard("home/#/"));
+    EXPECT_TRUE(EZMQTopicTrie::isValidWildcard("#"));
+    EXPECT_FALSE(EZMQTopicTrie::isValidWildcard("home/kitchen+/"));
+    EXPECT_FALSE(EZMQTopicTrie::isValidWildcard("home/++/"));
+    EXPECT_FALSE(EZMQTopicTrie::isValidWildcard("home/#/light/"));
+
+    EXPECT_EQ("home/", EZMQTopicTrie::getLiteralPrefix("home/+/light/"));
+    EXPECT_EQ("", EZMQTopicTrie::getLiteralPrefix("#/"));
+    EXPECT_EQ("home/kitchen/", EZMQTopicTrie::getLiteralPrefix("home/kitchen/"));
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "EZMQTracer.h"
+#include "UnitTestHelper.h"
+
+using namespace ezmq;
+
+#define TRACE_FILE "ezmq_tracer_test.json"
+
+class EZMQTracerTest: public TestWithMock
+{
+protected:
+    void SetUp()
+    {
+        TestWithMock::SetUp();
+    }
+
+    void TearDown()
+    {
+        if(EZMQTracer::getInstance().isRecording())
+        {
+            EZMQTracer::getInstance().stop();
+        }
+        remove(TRACE_FILE);
+        TestWithMock::TearDown();
+    }
+
+    std::string readTrace()
+    {
+        std::ifstream file(TRACE_FILE);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    size_t countOf(const std::string &content, const std::string &str)
+    {
+        size_t count = 0;
+        for (size_t pos = content.find(str); pos != std::string::npos;
+            pos = content.find(str, pos + 1))
+        {
+            count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(EZMQTracerTest, startStop)
+{
+    EZMQTracer &tracer = EZMQTracer::getInstance();
+    EXPECT_FALSE(tracer.isRecording());
+    EXPECT_EQ(EZMQ_ERROR, tracer.stop());
+    EXPECT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    EXPECT_TRUE(tracer.isRecording());
+    EXPECT_EQ(EZMQ_ERROR, tracer.start(TRACE_FILE));
+    EXPECT_EQ(EZMQ_OK, tracer.stop());
+    EXPECT_FALSE(tracer.isRecording());
+
+    std::string content = readTrace();
+    EXPECT_EQ(0u, content.find("{\"traceEvents\":["));
+    EXPECT_EQ(0u, countOf(content, "\"ph\":\"X\""));
+}
+
+TEST_F(EZMQTracerTest, traceScope)
+{
+    EZMQTracer &tracer = EZMQTracer::getInstance();
+    ASSERT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    {
+        EZMQTraceScope outer("outer");
+        EZMQTraceScope inner("inner");
+        inner.end();
+    }
+    ASSERT_EQ(EZMQ_OK, tracer.stop());
+
+    std::string content = readTrace();
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"outer\""));
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"inner\""));
+    EXPECT_EQ(2u, countOf(content, "\"ph\":\"X\""));
+}
+
+TEST_F(EZMQTracerTest, traceScopeNotRecording)
+{
+    {
+        EZMQTraceScope scope("ignored");
+    }
+    EZMQTracer &tracer = EZMQTracer::getInstance();
+    ASSERT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    ASSERT_EQ(EZMQ_OK, tracer.stop());
+    EXPECT_EQ(0u, countOf(readTrace(), "\"name\":\"ignored\""));
+}
+
+TEST_F(EZMQTracerTest, traceThreads)
+{
+    EZMQTracer &tracer = EZMQTracer::getInstance();
+    ASSERT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    std::thread thread([]
+    {
+        EZMQTraceScope scope("thread");
+    });
+    thread.join();
+    {
+        EZMQTraceScope scope("main");
+    }
+    ASSERT_EQ(EZMQ_OK, tracer.stop());
+
+    std::string content = readTrace();
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"thread\""));
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"main\""));
+    EXPECT_EQ(0u, tracer.getDroppedCount());
+}
+
+TEST_F(EZMQTracerTest, traceThreadExitAfterStop)
+{
+    EZMQTracer &tracer = EZMQTracer::getInstance();
+    ASSERT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    std::atomic<bool> recorded(false);
+    std::atomic<bool> stopped(false);
+    std::thread thread([&recorded, &stopped]
+    {
+        {
+            EZMQTraceScope scope("thread");
+        }
+        recorded = true;
+        // Exit once recording has stopped, the buffer is released at once
+        while (!stopped)
+        {
+            std::this_thread::yield();
+        }
+    });
+    while (!recorded)
+    {
+        std::this_thread::yield();
+    }
+    EZMQErrorCode result = tracer.stop();
+    stopped = true;
+    thread.join();
+    ASSERT_EQ(EZMQ_OK, result);
+
+    std::string content = readTrace();
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"thread\""));
+
+    ASSERT_EQ(EZMQ_OK, tracer.start(TRACE_FILE));
+    {
+        EZMQTraceScope scope("main");
+    }
+    ASSERT_EQ(EZMQ_OK, tracer.stop());
+    content = readTrace();
+    EXPECT_EQ(0u, countOf(content, "\"name\":\"thread\""));
+    EXPECT_EQ(1u, countOf(content, "\"name\":\"main\""));
+}
@@ -84,6 +84,21 @@ ezmq::Event getProtoBufEvent()
     return event;
 }
 
+ezmq::Event getTypedEvent()
+{
+    ezmq::Event event = getProtoBufEvent();
+    ezmq::Reading *reading = event.mutable_reading(0);
+    reading->set_double_value(10.5);
+    reading->set_int_value(-10);
+    reading->set_binary_value(std::string("\x00\x01\x02", 3));
+    for (int i = 0; i < 8; i++)
+    {
+        reading->add_double_values(i * 0.25);
+        reading->add_int_values(-i * 1000);
+    }
+    return event;
+}
+
 ezmq::EZMQByteData getByteData()
 {
     //Form a byte data event